@@ -7,7 +7,7 @@ from fabricate import *
 
 
 CC = os.getenv('CC', 'gcc')
-CCFLAGS = '-std=c99 -Wall -W'
+CCFLAGS = '-std=c99 -Wall -W -pthread'
 DEBUG_FLAGS   = '-O0 -g -DDEBUG'
 RELEASE_FLAGS = '-O3'
 
@@ -56,7 +56,7 @@ def compile_tests():
         cmd.extend(CCFLAGS.split(' '))
         cmd.extend(DEBUG_FLAGS.split(' '))
         cmd.extend(['-Isrc', cfile, 'build/debug/librandomtrees.a',
-                    '-o', strip_ext(cfile) + '.exe', '-lm'])
+                    '-o', strip_ext(cfile) + '.exe', '-lm', '-ldl'])
         run(*cmd)
 
 
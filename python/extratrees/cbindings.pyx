@@ -1,30 +1,50 @@
 import numpy
+import scipy.sparse
 cimport cython
 cimport numpy as np
-from libc.stdlib cimport malloc, free
+from libc.stdlib cimport malloc, realloc, free
+from libc.string cimport memcpy
 from libc.stdint cimport uint32_t
 from libc cimport math
 from libcpp cimport bool
 from cextratrees cimport (ET_problem, ET_problem_destroy, ET_load_libsvm_file,
+                          ET_problem_collapse, ET_problem_view,
+                          ET_problem_view_init,
+                          ET_problem_view_init_informative,
+                          ET_problem_view_destroy, ET_forest_build_view,
+                          ET_forest_build_multiprocess_view,
+                          ET_FLOAT32, ET_FLOAT64, ET_UINT8,
                           ET_forest, ET_forest_destroy, ET_forest_build,
+                          ET_forest_build_multiprocess, ET_forest_merge,
                           ET_forest_predict, ET_forest_predict_regression,
-                          ET_forest_predict_quantile,
+                          ET_forest_predict_quantiles_batch,
                           ET_forest_predict_class_majority,
                           ET_forest_predict_probability,
-                          ET_forest_neighbors, ET_params,
+                          ET_forest_neighbors_batch, ET_neighbors_csr,
+                          ET_neighbors_csr_destroy, ET_params,
                           ET_forest_predict_class_bayes,
+                          ET_matrix, double_vec, ET_forest_classes,
+                          ET_forest_predict_regression_batch,
+                          ET_forest_predict_class_majority_batch,
+                          ET_forest_predict_class_bayes_batch,
+                          ET_forest_predict_probability_batch,
                           class_probability_vec, class_probability,
                           ET_forest_feature_importance, uchar_vec,
                           ET_forest_dump, ET_forest_load, ET_tree, tree_vec,
-                          ET_tree_dump, ET_tree_load)
+                          ET_tree_dump, ET_tree_load, ET_tree_summarize,
+                          ET_forest_summarize_splits)
 
 
 cdef class Problem:
 
     cdef ET_problem *_prob
+    cdef ET_problem_view _view
+    cdef bool _informative
     cdef _X
 
     def __dealloc__(self):
+        if self._informative:
+            ET_problem_view_destroy(&self._view)
         if self._prob:
             if self._X is not None:
                 free(self._prob.labels)
@@ -37,57 +57,112 @@ cdef class Problem:
                      number_of_trees=100,
                      regression=False,
                      min_split_size=1,
-                     select_features_with_replacement=False):
+                     select_features_with_replacement=False,
+                     single_precision=False,
+                     mad_diversity=False,
+                     class_sample_cap=0,
+                     n_workers=1):
         cdef ET_params params
         cdef ET_forest *cforest
-        cdef ET_problem *cprob = self._prob
+        cdef ET_problem_view *cview = &self._view
+        cdef uint32_t _n_workers = n_workers
 
         if number_of_features_tested is None:
             if regression:
-                number_of_features_tested = cprob.n_features
+                number_of_features_tested = cview.n_features
             else:
                 number_of_features_tested = math.ceil(
-                                                math.sqrt(cprob.n_features))
+                                                math.sqrt(cview.n_features))
 
         params.number_of_features_tested = number_of_features_tested
         params.number_of_trees = number_of_trees
         params.regression = regression
+        params.single_precision = single_precision
+        params.mad_diversity = mad_diversity
         params.min_split_size = min_split_size
         params.select_features_with_replacement = \
                                              select_features_with_replacement
+        params.class_sample_cap = class_sample_cap
 
         with nogil:
-            cforest = ET_forest_build(cprob, &params)
+            if _n_workers > 1:
+                cforest = ET_forest_build_multiprocess_view(cview, &params,
+                                                            _n_workers)
+            else:
+                cforest = ET_forest_build_view(cview, &params, NULL)
+        if not cforest:
+            raise MemoryError()
         return forest_factory(cforest)
 
+    def drop_uninformative_features(self, n_threads=1):
+        """Train on the features that are neither constant nor duplicated.
+        Split nodes keep the original feature ids."""
+        cdef uint32_t _n_threads = n_threads
+        cdef int ret
+        if self._informative:
+            return self
+        with nogil:
+            ret = ET_problem_view_init_informative(&self._view, self._prob,
+                                                   _n_threads)
+        if ret:
+            raise MemoryError()
+        self._informative = True
+        return self
+
+    property weights:
+        def __get__(self):
+            cdef int i
+            if not self._prob.weights:
+                return None
+            weights = numpy.empty(shape=(self._prob.n_samples,),
+                                  dtype=numpy.uint32)
+            for i in xrange(self._prob.n_samples):
+                weights[i] = self._prob.weights[i]
+            return weights
+
 
-cdef Problem problem_factory(ET_problem *prob,
-                           np.ndarray[np.float32_t, ndim=2, mode='fortran'] X):
+cdef Problem problem_factory(ET_problem *prob, np.ndarray X):
     cdef Problem instance = Problem.__new__(Problem)
-    X.flags.writeable = False
+    if X is not None:
+        X.flags.writeable = False
     instance._prob = prob
     instance._X = X
+    instance._informative = False
+    ET_problem_view_init(&instance._view, prob)
     return instance
 
 
-cdef double _p_simple(ET_forest *f, float *v, double quantile,
-                                        uint32_t curtail, bool _) nogil:
-    return ET_forest_predict(f, v)
+cdef int _b_regression(ET_forest *f, ET_matrix *X, uint32_t curtail,
+                       bool _, uint32_t n_threads, double *y) nogil:
+    return ET_forest_predict_regression_batch(f, X, curtail, n_threads, y)
+
+cdef int _b_class_majority(ET_forest *f, ET_matrix *X, uint32_t curtail,
+                           bool _, uint32_t n_threads, double *y) nogil:
+    return ET_forest_predict_class_majority_batch(f, X, curtail, n_threads,
+                                                  y)
+
+cdef int _b_cl_bayes(ET_forest *f, ET_matrix *X, uint32_t curtail,
+                     bool smooth, uint32_t n_threads, double *y) nogil:
+    return ET_forest_predict_class_bayes_batch(f, X, curtail, smooth,
+                                               n_threads, y)
 
-cdef double _p_regression(ET_forest *f, float *v, double quantile,
-                                        uint32_t curtail, bool _) nogil:
-    if quantile == -1:
-        return ET_forest_predict_regression(f, v, curtail)
-    else:
-        return ET_forest_predict_quantile(f, v, quantile, curtail)
 
-cdef double _p_class_majority(ET_forest *f, float *v, double quantile,
-                                        uint32_t curtail, bool _) nogil:
-    return ET_forest_predict_class_majority(f, v, curtail)
+# X as a float32 matrix in C or fortran order, copied only if needed
+cdef np.ndarray batch_matrix(X, ET_forest *forest, ET_matrix *matrix):
+    cdef np.ndarray cX = numpy.asarray(X, dtype=numpy.float32)
 
-cdef double _p_cl_bayes(ET_forest *f, float *v, double quantile,
-                                        uint32_t curtail, bool smooth) nogil:
-    return ET_forest_predict_class_bayes(f, v, curtail, smooth)
+    if cX.ndim != 2:
+        raise ValueError('X.ndim != 2')
+    if not cX.flags.c_contiguous and not cX.flags.f_contiguous:
+        cX = numpy.ascontiguousarray(cX)
+    if cX.shape[1] < forest.n_features:
+        raise ValueError('X.shape[1] < %d features' % forest.n_features)
+
+    matrix.data = <float *> np.PyArray_DATA(cX)
+    matrix.n_rows = cX.shape[0]
+    matrix.n_columns = cX.shape[1]
+    matrix.column_major = not cX.flags.c_contiguous
+    return cX
 
 
 cdef class Forest:
@@ -101,28 +176,35 @@ cdef class Forest:
 
     @cython.boundscheck(False)
     @cython.wraparound(False)
-    def predict(self, np.ndarray[np.float32_t, ndim=2] X not None,
-                bytes mode=None, quantile=-1, curtail=1, smooth=False):
-        cdef np.ndarray[np.float64_t, ndim=1] y
-        cdef float *vector
-        cdef int sample_idx, feature_idx
+    def predict(self, X not None, bytes mode=None, quantile=-1, curtail=1,
+                smooth=False, n_threads=1):
+        cdef np.ndarray cX, y, cquantiles
+        cdef ET_matrix matrix
+        cdef double *out
+        cdef double *_quantiles
+        cdef int ret
         cdef uint32_t _curtail = curtail
         cdef bool _smooth = smooth
-        cdef double _quantile = quantile
-        cdef double (*predict_f)(ET_forest *f,
-                                 float *v,
-                                 double q,
-                                 uint32_t c,
-                                 bool s) nogil
+        cdef uint32_t _n_quantiles
+        cdef uint32_t _n_threads = n_threads
+        cdef int (*predict_f)(ET_forest *f,
+                              ET_matrix *X,
+                              uint32_t c,
+                              bool s,
+                              uint32_t t,
+                              double *y) nogil
 
         if mode is None:
-            predict_f = _p_simple
+            if self._forest.params.regression:
+                predict_f = _b_regression
+            else:
+                predict_f = _b_class_majority
         elif mode == 'regression':
-            predict_f = _p_regression
+            predict_f = _b_regression
         elif mode == 'classify_majority':
-            predict_f = _p_class_majority
+            predict_f = _b_class_majority
         elif mode == 'classify_bayes':
-            predict_f = _p_cl_bayes
+            predict_f = _b_cl_bayes
         else:
             raise ValueError('unsupported predict mode: %r' % mode)
 
@@ -131,103 +213,125 @@ cdef class Forest:
 
         if mode != 'classify_bayes' and smooth == True:
             raise ValueError('smooth supported only for "classify_bayes" mode')
-        if quantile != -1 and mode == 'regression':
+        if numpy.ndim(quantile) == 0 and quantile == -1:
+            quantile = None
+        if quantile is not None and mode != 'regression':
             raise ValueError('quantile supported only for "regression" mode')
 
-        y = numpy.empty(shape=(X.shape[0],), dtype=numpy.float64)
-        vector = <float *> malloc(sizeof(float) * X.shape[1])
-        if not vector:
-            raise MemoryError()
-
-        for sample_idx in xrange(X.shape[0]):
-            for feature_idx in xrange(X.shape[1]):
-                vector[feature_idx] = X[sample_idx, feature_idx]
+        cX = batch_matrix(X, self._forest, &matrix)
 
+        if quantile is None:
+            y = numpy.empty(shape=(matrix.n_rows,), dtype=numpy.float64)
+            out = <double *> np.PyArray_DATA(y)
             with nogil:
-                y[sample_idx] = predict_f(self._forest, vector, _quantile,
-                                          _curtail, _smooth)
-
-        free(vector)
+                ret = predict_f(self._forest, &matrix, _curtail, _smooth,
+                                _n_threads, out)
+            if ret:
+                raise MemoryError()
+            return y
+
+        # a sequence of quantiles gives a column per quantile, all from the
+        # same lookups
+        cquantiles = numpy.ascontiguousarray(numpy.atleast_1d(quantile),
+                                             dtype=numpy.float64)
+        _quantiles = <double *> np.PyArray_DATA(cquantiles)
+        _n_quantiles = cquantiles.shape[0]
+        y = numpy.empty(shape=(matrix.n_rows, _n_quantiles),
+                        dtype=numpy.float64)
+        out = <double *> np.PyArray_DATA(y)
+        with nogil:
+            ret = ET_forest_predict_quantiles_batch(self._forest, &matrix,
+                                                    _quantiles, _n_quantiles,
+                                                    _curtail, _n_threads,
+                                                    out)
+        if ret:
+            raise MemoryError()
+        if numpy.ndim(quantile) == 0:
+            return y[:, 0]
         return y
 
     @cython.boundscheck(False)
     @cython.wraparound(False)
-    def predict_proba(self, np.ndarray[np.float32_t, ndim=2] X not None,
-                      curtail=1, smooth=False):
-        cdef float *vector
-        cdef int sample_idx, feature_idx
+    def predict_proba(self, X not None, curtail=1, smooth=False,
+                      n_threads=1):
+        cdef np.ndarray cX
+        cdef ET_matrix matrix
+        cdef double_vec *cclasses
+        cdef double *out
+        cdef int ret
         cdef uint32_t _curtail = curtail
         cdef bool _smooth = smooth
-        cdef class_probability_vec *cpv
-        cdef class_probability *cp
-        cdef np.ndarray[np.float64_t, ndim=1] classes = None
-        cdef np.ndarray[np.float64_t, ndim=2] probas = None
-
-        vector = <float *> malloc(sizeof(float) * X.shape[1])
-        if not vector:
-            raise MemoryError()
-
-        for sample_idx in xrange(X.shape[0]):
-            for feature_idx in xrange(X.shape[1]):
-                vector[feature_idx] = X[sample_idx, feature_idx]
-
-            with nogil:
-                cpv = ET_forest_predict_probability(self._forest, vector,
-                                                    _curtail, _smooth)
-            if not cpv:
-                raise MemoryError()
-
-            if classes is None:
-                shape = (X.shape[0], cpv.n)
-                probas  = numpy.empty(shape=shape, dtype=numpy.float64)
-                classes = numpy.empty(shape=(cpv.n,), dtype=numpy.float64)
-                for i in xrange(cpv.n):
-                    cp = &cpv.a[i]
-                    classes[i] = cp.label
-                    probas[sample_idx, i]  = cp.probability
-            else:
-                for i in xrange(cpv.n):
-                    cp = &cpv.a[i]
-                    probas[sample_idx, i]  = cp.probability
+        cdef uint32_t _n_threads = n_threads
+        cdef np.ndarray[np.float64_t, ndim=1] classes
+        cdef np.ndarray[np.float64_t, ndim=2] probas
 
-            free(cpv.a)
-            free(cpv)
+        cX = batch_matrix(X, self._forest, &matrix)
 
-        free(vector)
+        cclasses = ET_forest_classes(self._forest)
+        if not cclasses:
+            raise MemoryError()
+        classes = numpy.empty(shape=(cclasses.n,), dtype=numpy.float64)
+        for i in xrange(cclasses.n):
+            classes[i] = cclasses.a[i]
+        free(cclasses.a)
+        free(cclasses)
+
+        probas = numpy.empty(shape=(matrix.n_rows, classes.shape[0]),
+                             dtype=numpy.float64)
+        out = <double *> np.PyArray_DATA(probas)
+        with nogil:
+            ret = ET_forest_predict_probability_batch(self._forest, &matrix,
+                                                      _curtail, _smooth,
+                                                      _n_threads, out)
+        if ret:
+            raise MemoryError()
         return classes, probas
 
     @cython.boundscheck(False)
     @cython.wraparound(False)
-    def neighbors(self, np.ndarray[np.float32_t, ndim=2] X not None, curtail=1):
-        cdef float *vector
-        cdef double *weights
-        cdef int sample_idx, feature_idx
+    def neighbors(self, X not None, curtail=1, top_k=0, n_threads=1):
+        """Training sample weights of each row of X, as a scipy.sparse
+        csr_matrix of shape (rows, training samples). With top_k > 0, only
+        the top_k heaviest samples of each row are kept."""
+        cdef np.ndarray cX
+        cdef ET_matrix matrix
+        cdef ET_neighbors_csr csr
+        cdef size_t n_neighbors
+        cdef int ret
         cdef uint32_t _curtail = curtail
-        cdef np.ndarray[np.float64_t, ndim=2] adiacency
-
-        adiacency = numpy.empty(shape=(X.shape[0], self._forest.n_samples),
-                                dtype=numpy.float64)
+        cdef uint32_t _top_k = top_k
+        cdef uint32_t _n_threads = n_threads
+        cdef np.ndarray indptr, indices, data
 
-        vector = <float *> malloc(sizeof(float) * X.shape[1])
-        if not vector:
+        cX = batch_matrix(X, self._forest, &matrix)
+        with nogil:
+            ret = ET_forest_neighbors_batch(self._forest, &matrix, _curtail,
+                                            _top_k, _n_threads, &csr)
+        if ret:
             raise MemoryError()
 
-        for sample_idx in xrange(X.shape[0]):
-            for feature_idx in xrange(X.shape[1]):
-                vector[feature_idx] = X[sample_idx, feature_idx]
-
-            with nogil:
-                weights = ET_forest_neighbors(self._forest, vector, _curtail)
-            if not weights:
-                raise MemoryError()
-
-            for feature_idx in xrange(X.shape[1]):
-                adiacency[sample_idx, feature_idx] = weights[feature_idx]
-
-            free(weights)
-
-        free(vector)
-        return adiacency
+        n_neighbors = csr.row_offsets[csr.n_rows]
+        indptr = numpy.empty(shape=(csr.n_rows + 1,), dtype=numpy.uintp)
+        indices = numpy.empty(shape=(n_neighbors,), dtype=numpy.uint32)
+        data = numpy.empty(shape=(n_neighbors,), dtype=numpy.float64)
+        memcpy(np.PyArray_DATA(indptr), csr.row_offsets,
+               (csr.n_rows + 1) * sizeof(size_t))
+        memcpy(np.PyArray_DATA(indices), csr.sample_idxs.a,
+               n_neighbors * sizeof(uint32_t))
+        memcpy(np.PyArray_DATA(data), csr.weights.a,
+               n_neighbors * sizeof(double))
+        ET_neighbors_csr_destroy(&csr)
+
+        return scipy.sparse.csr_matrix((data, indices, indptr),
+                                       shape=(matrix.n_rows,
+                                              self._forest.n_samples))
+
+    def summarize_splits(self):
+        """Aggregate the labels below each split node, so that predictions
+        with a large curtail stop at the node. Pickled, appended and merged
+        trees are summarized again."""
+        if ET_forest_summarize_splits(self._forest):
+            raise MemoryError()
 
     @cython.boundscheck(False)
     @cython.wraparound(False)
@@ -270,10 +374,27 @@ cdef class Forest:
     cpdef append(self, bytes pickle_data):
         cdef tree_vec *trees = &self._forest.trees
         cdef unsigned char *buffer = pickle_data
+        cdef ET_tree *new_a
+        cdef size_t new_m
+
+        if trees.n == trees.m:
+            new_m = trees.m * 2 if trees.m else 2
+            new_a = <ET_tree *> realloc(trees.a, sizeof(ET_tree) * new_m)
+            if not new_a:
+                raise MemoryError()
+            trees.a, trees.m = new_a, new_m
 
         cdef ET_tree tree = ET_tree_load(&buffer)
+        if not tree:
+            raise MemoryError()
         trees.a[trees.n] = tree
         trees.n += 1
+        if ET_tree_summarize(self._forest, tree):
+            raise MemoryError()
+
+    def merge(self, Forest other not None):
+        if ET_forest_merge(self._forest, other._forest):
+            raise ValueError('forests are not compatible')
 
 
 cdef Forest forest_factory(ET_forest *forest):
@@ -286,7 +407,7 @@ def forest_unpickler(bytes pickle_data):
     cdef unsigned char *buffer = pickle_data
     cdef ET_forest *cforest = ET_forest_load(&buffer)
     if not cforest:
-        raise MemoryError()
+        raise ValueError('not a forest dump of a supported version')
     return forest_factory(cforest)
 
 
@@ -324,12 +445,25 @@ cdef class ForestIterator:
         return pickle_data
 
 
+# float32, float64 and uint8 matrices are used without conversion
+_FEATURE_TYPES = {numpy.dtype(numpy.float32): ET_FLOAT32,
+                  numpy.dtype(numpy.float64): ET_FLOAT64,
+                  numpy.dtype(numpy.uint8):   ET_UINT8}
+
+
 @cython.boundscheck(False)
 @cython.wraparound(False)
 def convert_to_problem(
-    np.ndarray[np.float32_t, ndim=2, mode='fortran'] X not None,
-    np.ndarray[np.float64_t, ndim=1] y not None):
-
+    np.ndarray X not None,
+    np.ndarray[np.float64_t, ndim=1] y not None,
+    collapse=False):
+
+    if X.ndim != 2:
+        raise ValueError('X.ndim != 2')
+    if X.dtype not in _FEATURE_TYPES:
+        raise ValueError('unsupported X.dtype: %s' % X.dtype)
+    if not X.flags.f_contiguous:
+        raise ValueError('X is not fortran contiguous')
     if y.shape[0] != X.shape[0]:
         raise ValueError('y.shape[0] != X.shape[0]')
 
@@ -337,6 +471,7 @@ def convert_to_problem(
     cdef int i, j
 
     cdef ET_problem *cprob = <ET_problem *> malloc(sizeof(ET_problem))
+    cdef ET_problem *collapsed
 
     n_features = X.shape[1]
     n_samples  = X.shape[0]
@@ -344,14 +479,25 @@ def convert_to_problem(
     cprob.n_features = n_features
     cprob.n_samples = n_samples
 
-    cprob.vectors = <float *> np.PyArray_DATA(X)
+    cprob.vectors = np.PyArray_DATA(X)
+    cprob.feature_type = _FEATURE_TYPES[X.dtype]
     cprob.labels = <double *> malloc(sizeof(double) * n_samples)
+    cprob.weights = NULL
     if not cprob.labels or not cprob.vectors:
         raise MemoryError()
 
     for i in xrange(n_samples):
         cprob.labels[i] = y[i]
 
+    if collapse:
+        # the collapsed problem owns copies of the distinct samples
+        collapsed = ET_problem_collapse(cprob)
+        free(cprob.labels)
+        free(cprob)
+        if not collapsed:
+            raise MemoryError()
+        return problem_factory(collapsed, None)
+
     return problem_factory(cprob, X)
 
 
@@ -360,15 +506,19 @@ def convert_to_problem(
 def convert_from_problem(Problem prob not None):
     cdef int i, j
     cdef ET_problem *cprob = prob._prob
-    cdef np.ndarray[np.float32_t, ndim=2] X
+    cdef np.ndarray loaded_X
     cdef np.ndarray[np.float64_t, ndim=1] y
 
+    # problems owned by the library (loaded from file or collapsed) are
+    # copied out, in their feature type
     if prob._X is None:
-        X = numpy.empty(shape=(cprob.n_samples, cprob.n_features),
-                        dtype=numpy.float32)
-        for j in xrange(cprob.n_features):
-            for i in xrange(cprob.n_samples):
-                X[i, j] = cprob.vectors[j * cprob.n_samples + i]
+        dtype = [t for t in _FEATURE_TYPES
+                   if _FEATURE_TYPES[t] == cprob.feature_type][0]
+        loaded_X = numpy.empty(shape=(cprob.n_features, cprob.n_samples),
+                               dtype=dtype)
+        memcpy(np.PyArray_DATA(loaded_X), cprob.vectors,
+               loaded_X.nbytes)
+        X = loaded_X.T
     else:
         X = prob._X
 
@@ -381,14 +531,29 @@ def convert_from_problem(Problem prob not None):
     return X, y
 
 
-def train(X, y, **params):
-    return convert_to_problem(X, y)._train(**params)
+def train(X, y, collapse=False, drop_uninformative=False, **params):
+    problem = convert_to_problem(X, y, collapse)
+    if drop_uninformative:
+        problem.drop_uninformative_features()
+    return problem._train(**params)
 
 
-def load(bytes fname):
+def load(bytes fname, collapse=False, drop_uninformative=False):
     cdef ET_problem *cprob = ET_load_libsvm_file(fname)
+    cdef ET_problem *collapsed
 
     if not cprob:
         raise MemoryError()
 
-    return problem_factory(cprob, None)
+    if collapse:
+        collapsed = ET_problem_collapse(cprob)
+        ET_problem_destroy(cprob)
+        free(cprob)
+        if not collapsed:
+            raise MemoryError()
+        cprob = collapsed
+
+    problem = problem_factory(cprob, None)
+    if drop_uninformative:
+        problem.drop_uninformative_features()
+    return problem
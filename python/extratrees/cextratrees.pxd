@@ -4,14 +4,45 @@ from libc.stdint cimport uint32_t
 
 cdef extern from "extratrees.h":
     
+    ctypedef enum ET_feature_type:
+        ET_FLOAT32
+        ET_FLOAT64
+        ET_UINT8
+
     ctypedef struct ET_problem:
-        float *vectors
+        void *vectors
         double *labels
+        uint32_t *weights
         uint32_t n_features
         uint32_t n_samples
+        ET_feature_type feature_type
+
+    ctypedef struct ET_problem_view:
+        ET_problem *prob
+        uint32_t *sample_idxs
+        uint32_t n_samples
+        uint32_t *feature_idxs
+        uint32_t n_features
 
     cdef void ET_problem_destroy(ET_problem *prob)
+    cdef void ET_problem_view_init(ET_problem_view *view, ET_problem *prob)
+    cdef int ET_problem_view_init_informative(ET_problem_view *view,
+                                              ET_problem *prob,
+                                              uint32_t n_threads) nogil
+    cdef void ET_problem_view_destroy(ET_problem_view *view)
     cdef ET_problem *ET_load_libsvm_file(char *fname)
+    cdef ET_problem *ET_problem_collapse(ET_problem *prob)
+
+    ctypedef struct ET_params:
+        
+        uint32_t number_of_features_tested
+        uint32_t number_of_trees
+        bool regression
+        bool single_precision
+        bool mad_diversity
+        uint32_t min_split_size
+        bool select_features_with_replacement
+        uint32_t class_sample_cap
 
     ctypedef struct ET_base_node:
         pass
@@ -26,18 +57,23 @@ cdef extern from "extratrees.h":
         uint32_t n_features
         uint32_t n_samples
         tree_vec trees
+        ET_params params
 
     cdef void ET_forest_destroy(ET_forest *forest)
     cdef ET_forest *ET_forest_build(ET_problem *problem, ET_params *parmas) \
                                                                         nogil
-
-    ctypedef struct ET_params:
-        
-        uint32_t number_of_features_tested
-        uint32_t number_of_trees
-        bool regression
-        uint32_t min_split_size
-        bool select_features_with_replacement
+    cdef ET_forest *ET_forest_build_multiprocess(ET_problem *problem,
+                                                 ET_params *params,
+                                                 uint32_t n_workers) nogil
+    ctypedef struct ET_train_stats:
+        pass
+    cdef ET_forest *ET_forest_build_view(ET_problem_view *view,
+                                         ET_params *params,
+                                         ET_train_stats *stats) nogil
+    cdef ET_forest *ET_forest_build_multiprocess_view(ET_problem_view *view,
+                                                      ET_params *params,
+                                                      uint32_t n_workers) nogil
+    cdef int ET_forest_merge(ET_forest *forest, ET_forest *other)
 
     ctypedef struct class_probability:
         double label
@@ -66,9 +102,67 @@ cdef extern from "extratrees.h":
                                              float *vector,
                                              uint32_t curtail_min_size,
                                              bool smooth) nogil
+    ctypedef struct double_vec:
+        size_t n, m
+        double *a
+
+    ctypedef struct ET_matrix:
+        float *data
+        uint32_t n_rows
+        uint32_t n_columns
+        bool column_major
+
+    cdef double_vec *ET_forest_classes(ET_forest *forest)
+    cdef int ET_forest_predict_regression_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             uint32_t curtail_min_size,
+                                             uint32_t n_threads,
+                                             double *y) nogil
+    cdef int ET_forest_predict_class_majority_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             uint32_t curtail_min_size,
+                                             uint32_t n_threads,
+                                             double *y) nogil
+    cdef int ET_forest_predict_class_bayes_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             uint32_t curtail_min_size,
+                                             bool smooth,
+                                             uint32_t n_threads,
+                                             double *y) nogil
+    cdef int ET_forest_predict_probability_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             uint32_t curtail_min_size,
+                                             bool smooth,
+                                             uint32_t n_threads,
+                                             double *probabilities) nogil
     cdef double *ET_forest_neighbors(ET_forest *forest,
                                              float *vector,
                                              uint32_t curtail_min_size) nogil
+
+    ctypedef struct uint_vec:
+        size_t n, m
+        uint32_t *a
+
+    ctypedef struct ET_neighbors_csr:
+        uint32_t n_rows
+        size_t *row_offsets
+        uint_vec sample_idxs
+        double_vec weights
+
+    cdef int ET_forest_predict_quantiles_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             double *quantiles,
+                                             uint32_t n_quantiles,
+                                             uint32_t curtail_min_size,
+                                             uint32_t n_threads,
+                                             double *y) nogil
+    cdef int ET_forest_neighbors_batch(ET_forest *forest,
+                                             ET_matrix *X,
+                                             uint32_t curtail_min_size,
+                                             uint32_t top_k,
+                                             uint32_t n_threads,
+                                             ET_neighbors_csr *csr) nogil
+    cdef void ET_neighbors_csr_destroy(ET_neighbors_csr *csr)
     cdef double *ET_forest_feature_importance(ET_forest *forest,
                                              uint32_t curtail_min_size)
 
@@ -81,4 +175,6 @@ cdef extern from "extratrees.h":
                                                 bool with_trees)
     
     cdef ET_tree ET_tree_load(unsigned char **bufferp)
+    cdef int ET_tree_summarize(ET_forest *forest, ET_tree tree)
+    cdef int ET_forest_summarize_splits(ET_forest *forest)
     cdef ET_forest *ET_forest_load(unsigned char **bufferp)
@@ -2,25 +2,24 @@ import glob
 import numpy
 from os.path import join
 from setuptools import setup, find_packages, Extension
+from Cython.Build import cythonize
 
-sources = [join("extratrees", "cbindings.c"),
-           join("extratrees", "cextratrees.c")]
+sources = [join("extratrees", "cbindings.pyx")]
 
 sources.extend(glob.glob(join("..", "src", "*.c")))
 
-numpy_include = join(numpy.__path__[0], 'core', 'include')
-
 
 setup(
     name='extratrees',
     version='dev',
     packages = find_packages(),
-    ext_modules = [
+    ext_modules = cythonize([
         Extension("extratrees.cbindings", sources,
-                  include_dirs=["../src", numpy_include],
-                  extra_compile_args=["-std=c99", "-O2",
-                                      "-Wno-unused", "-mtune=native"]),
+                  include_dirs=["../src", numpy.get_include()],
+                  extra_compile_args=["-std=c99", "-O2", "-pthread",
+                                      "-Wno-unused", "-mtune=native"],
+                  extra_link_args=["-pthread"]),
                   #extra_compile_args=["-std=c99", "-Wno-unused"]),
-    ],
+    ], include_path=["extratrees"]),
 )
 
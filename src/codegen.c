@@ -0,0 +1,289 @@
+#include <ctype.h>
+#include <stdint.h>
+
+#include "extratrees.h"
+#include "util.h"
+#include "log.h"
+#include "predict.h"
+
+
+// The generated source is C99 and only needs stdint.h. Each tree is a
+// function returning the index of its exit leaf in the leaf tables: split
+// conditions are immediates, the lower subtree follows its split and the
+// higher one is reached by goto. Trees are added in order, as by
+// ET_forest_predict, with the same compensated sum (regression) and the same
+// KISS2 draws for tied leaves (classification), so results are identical as
+// long as the source is not compiled with -ffast-math.
+
+typedef struct {
+    FILE *f;
+    const char *name;
+    uint32_t n_labels;          // goto labels of the current tree
+    kvec_t(ET_base_node *) leaves;
+} codegen_state;
+
+
+static bool valid_identifier(const char *name) {
+    if (! (isalpha((unsigned char) name[0]) || name[0] == '_')) return false;
+    for(const char *c = name; *c; c++) {
+        if (! (isalnum((unsigned char) *c) || *c == '_')) return false;
+    }
+    return true;
+}
+
+// leaves are numbered across the forest in emission order
+static int emit_node(codegen_state *cs, ET_base_node *node) {
+    if (IS_LEAF(node)) {
+        fprintf(cs->f, "    return %zu;\n", kv_size(cs->leaves));
+        kv_push(ET_base_node *, cs->leaves, node);
+    } else {
+        ET_split_node *sn = CAST_SPLIT(node);
+        uint32_t label = cs->n_labels++;
+
+        check(isfinite(sn->threshold), "threshold %g cannot be emitted",
+              sn->threshold);
+        fprintf(cs->f, "    if (! (v[%u] <= %af)) goto n%u;\n",
+                sn->feature_id, (double) sn->threshold, label);
+        check(! emit_node(cs, sn->lower_node), "could not emit lower node");
+        fprintf(cs->f, "n%u:\n", label);
+        check(! emit_node(cs, sn->higher_node), "could not emit higher node");
+    }
+    return 0;
+
+    exit:
+    return -1;
+}
+
+static void emit_doubles(FILE *f, const char *name, const char *table,
+                         double *values, size_t n) {
+    fprintf(f, "static const double %s_%s[%zu] = {", name, table, n);
+    for(size_t i = 0; i < n; i++) {
+        fprintf(f, "%s%a,", i % 4 ? " " : "\n    ", values[i]);
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+static void emit_uints(FILE *f, const char *name, const char *table,
+                       uint32_t *values, size_t n) {
+    fprintf(f, "static const uint32_t %s_%s[%zu] = {", name, table, n);
+    for(size_t i = 0; i < n; i++) {
+        fprintf(f, "%s%u,", i % 10 ? " " : "\n    ", values[i]);
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+
+// * regression
+
+static int emit_regression(codegen_state *cs, ET_forest *forest) {
+    FILE *f = cs->f;
+    const char *name = cs->name;
+    uint32_t n_trees = kv_size(forest->trees);
+    double_vec values;
+
+    kv_init(values);
+    for(size_t i = 0; i < kv_size(cs->leaves); i++) {
+        double value = leaf_regression(forest, kv_A(cs->leaves, i));
+        check(isfinite(value), "leaf value %g cannot be emitted", value);
+        kv_push(double, values, value);
+    }
+    emit_doubles(f, name, "leaf_values", values.a, kv_size(values));
+
+    fprintf(f,
+"static void %s_add(double *sum, double *compensation, double value) {\n"
+"    double t = *sum + value;\n"
+"    if ((*sum < 0 ? -*sum : *sum) >= (value < 0 ? -value : value)) {\n"
+"        *compensation += (*sum - t) + value;\n"
+"    } else {\n"
+"        *compensation += (value - t) + *sum;\n"
+"    }\n"
+"    *sum = t;\n"
+"}\n\n", name);
+
+    fprintf(f,
+"double %s(void *forest, float *vector) {\n"
+"    double sum = 0, compensation = 0;\n"
+"    (void) forest;\n", name);
+    for(uint32_t t = 0; t < n_trees; t++) {
+        fprintf(f, "    %s_add(&sum, &compensation, "
+                   "%s_leaf_values[%s_tree_%u(vector)]);\n",
+                name, name, name, t);
+    }
+    fprintf(f,
+"    return (sum + compensation) / %u.0;\n"
+"}\n", n_trees);
+
+    kv_destroy(values);
+    return 0;
+
+    exit:
+    kv_destroy(values);
+    return -1;
+}
+
+
+// * classification
+
+// the most frequent classes of each leaf, as indexes in the class frequency
+// table: a tree votes for one of them, drawn at random when they tie
+static int leaf_candidates(ET_forest *forest, ET_base_node *leaf,
+                           uint_vec *candidates) {
+    ET_class_counter *cc = leaf_classification(forest, leaf);
+    ET_class_counter *classes = forest->class_frequency;
+    uint32_t most_frequent_count = 0;
+
+    check_mem(cc);
+    for(size_t k = 0; k < kv_size(*cc); k++) {
+        if (kv_A(*cc, k).count > most_frequent_count) {
+            most_frequent_count = kv_A(*cc, k).count;
+        }
+    }
+    for(size_t k = 0; k < kv_size(*cc); k++) {
+        if (kv_A(*cc, k).count != most_frequent_count) continue;
+        for(uint32_t c = 0; c < kv_size(*classes); c++) {
+            if (kv_A(*classes, c).key == kv_A(*cc, k).key) {
+                kv_push(uint32_t, *candidates, c);
+                break;
+            }
+        }
+    }
+
+    ET_class_counter_destroy(*cc);
+    free(cc);
+    return 0;
+
+    exit:
+    return -1;
+}
+
+static int emit_classification(codegen_state *cs, ET_forest *forest) {
+    FILE *f = cs->f;
+    const char *name = cs->name;
+    uint32_t n_trees = kv_size(forest->trees);
+    size_t n_classes;
+    double_vec classes;
+    uint_vec offsets, candidates;
+    int ret = -1;
+
+    kv_init(classes);
+    kv_init(offsets);
+    kv_init(candidates);
+    n_classes = kv_size(*forest->class_frequency);
+    for(size_t c = 0; c < n_classes; c++) {
+        kv_push(double, classes, kv_A(*forest->class_frequency, c).key);
+    }
+    for(size_t i = 0; i < kv_size(cs->leaves); i++) {
+        kv_push(uint32_t, offsets, kv_size(candidates));
+        check_mem(! leaf_candidates(forest, kv_A(cs->leaves, i),
+                                    &candidates));
+    }
+    kv_push(uint32_t, offsets, kv_size(candidates));
+
+    emit_doubles(f, name, "classes", classes.a, n_classes);
+    emit_uints(f, name, "candidate_offsets", offsets.a, kv_size(offsets));
+    emit_uints(f, name, "candidates", candidates.a, kv_size(candidates));
+
+    // the generator and seed of ET_class_partial_majority
+    fprintf(f,
+"struct %s_kiss2 {\n"
+"    uint32_t mwc_upper, mwc_lower, cong, shr3;\n"
+"};\n\n"
+"static uint32_t %s_random_int(struct %s_kiss2 *r,\n"
+"        uint32_t max_val) {\n"
+"    uint32_t i;\n"
+"    do {\n"
+"        uint64_t mwc64 = UINT64_C(698769069) * r->mwc_lower + "
+                                                        "r->mwc_upper;\n"
+"        r->mwc_upper = mwc64 >> 32u;\n"
+"        r->mwc_lower = (uint32_t) mwc64;\n"
+"        r->cong = UINT32_C(69069) * r->cong + 12345u;\n"
+"        r->shr3 ^= r->shr3 << 13;\n"
+"        r->shr3 ^= r->shr3 >> 17;\n"
+"        r->shr3 ^= r->shr3 << 5;\n"
+"        i = (uint32_t) mwc64 + r->cong + r->shr3;\n"
+"    } while (i >= UINT32_MAX / max_val * max_val);\n"
+"    return i %% max_val;\n"
+"}\n\n", name, name, name);
+
+    fprintf(f,
+"static void %s_vote(uint32_t *votes, uint32_t *first_vote,\n"
+"        struct %s_kiss2 *r, uint32_t tree_idx, uint32_t leaf) {\n"
+"    uint32_t begin = %s_candidate_offsets[leaf];\n"
+"    uint32_t n = %s_candidate_offsets[leaf + 1] - begin;\n"
+"    uint32_t c = %s_candidates[begin + (n == 1 ? 0 : "
+                                            "%s_random_int(r, n))];\n"
+"    votes[c]++;\n"
+"    if (tree_idx < first_vote[c]) first_vote[c] = tree_idx;\n"
+"}\n\n", name, name, name, name, name, name);
+
+    // equal votes go to the class voted first
+    fprintf(f,
+"double %s(void *forest, float *vector) {\n"
+"    uint32_t votes[%zu] = {0}, first_vote[%zu], best = 0;\n"
+"    struct %s_kiss2 r = {0, 1, 2, 3};\n"
+"    (void) forest;\n"
+"    for(uint32_t c = 0; c < %zu; c++) first_vote[c] = UINT32_MAX;\n",
+            name, n_classes, n_classes, name, n_classes);
+    for(uint32_t t = 0; t < n_trees; t++) {
+        fprintf(f, "    %s_vote(votes, first_vote, &r, %u, %s_tree_%u(vector));"
+                   "\n", name, t, name, t);
+    }
+    fprintf(f,
+"    for(uint32_t c = 1; c < %zu; c++) {\n"
+"        if (votes[c] > votes[best] ||\n"
+"            (votes[c] == votes[best] && first_vote[c] < first_vote[best]))\n"
+"            best = c;\n"
+"    }\n"
+"    return %s_classes[best];\n"
+"}\n", n_classes, name);
+    ret = 0;
+
+    exit:
+    kv_destroy(classes);
+    kv_destroy(offsets);
+    kv_destroy(candidates);
+    return ret;
+}
+
+
+int ET_forest_codegen(ET_forest *forest, const char *name, FILE *f) {
+    codegen_state cs = {f, name, 0, {0, 0, NULL}};
+    uint32_t n_trees = kv_size(forest->trees);
+    int ret = -1;
+
+    check(valid_identifier(name), "invalid function name: %s", name);
+    check(n_trees > 0, "cannot generate the code of an empty forest");
+
+    fprintf(f, "/* %s: %s forest of %u trees on %u features,\n"
+               " * generated by libextratrees.\n"
+               " * double %s(void *forest, float *vector) returns the "
+               "prediction of\n"
+               " * ET_forest_predict, bit for bit. Do not compile with "
+               "-ffast-math. */\n\n"
+               "#include <stdint.h>\n\n",
+            name, forest->params.regression ? "regression" : "classification",
+            n_trees, forest->n_features, name);
+
+    for(uint32_t t = 0; t < n_trees; t++) {
+        fprintf(f, "static uint32_t %s_tree_%u(const float *v) {\n", name, t);
+        cs.n_labels = 0;
+        if (IS_LEAF(kv_A(forest->trees, t))) fprintf(f, "    (void) v;\n");
+        check(! emit_node(&cs, kv_A(forest->trees, t)),
+              "could not emit tree #%d", t);
+        fprintf(f, "}\n\n");
+    }
+    log_debug("%u trees, %zu leaves", n_trees, kv_size(cs.leaves));
+
+    if (forest->params.regression) {
+        check(! emit_regression(&cs, forest), "could not emit regression");
+    } else {
+        check(! emit_classification(&cs, forest),
+              "could not emit classification");
+    }
+    check(! ferror(f), "could not write the generated code");
+    ret = 0;
+
+    exit:
+    kv_destroy(cs.leaves);
+    return ret;
+}
@@ -0,0 +1,351 @@
+#include <stdint.h>
+
+#include "extratrees.h"
+#include "train.h"
+#include "util.h"
+#include "problem.h"
+#include "parallel.h"
+#include "log.h"
+
+
+// --- scoring ---
+
+// squared error for regression, misclassification for classification
+static inline double prediction_loss(bool regression, double y,
+                                     double label) {
+    return regression ? (y - label) * (y - label) : (double) (y != label);
+}
+
+// test rows are predicted by blocks, gathered column major
+#define SCORE_BLOCK_ROWS 1024
+
+// mean loss over the test samples, weighted by sample weight, of each
+// forest prefix: scores[p] for the first prefix_trees[p] trees
+static int forest_score(ET_forest *forest, ET_problem_view *test_view,
+                        uint32_t *prefix_trees, uint32_t n_prefixes,
+                        uint32_t n_threads, double *scores) {
+    ET_problem *prob = test_view->prob;
+    double total_weight = 0;
+    double *y = NULL;
+    ET_matrix X = {NULL, 0, prob->n_features, true};
+    bool regression = forest->params.regression;
+    int ret = -1;
+
+    X.data = malloc((size_t) SCORE_BLOCK_ROWS * prob->n_features *
+                    sizeof(float));
+    check_mem(X.data);
+    y = malloc((size_t) SCORE_BLOCK_ROWS * n_prefixes * sizeof(double));
+    check_mem(y);
+    for(uint32_t p = 0; p < n_prefixes; p++) scores[p] = 0;
+
+    for(uint32_t first = 0; first < test_view->n_samples;
+                            first += SCORE_BLOCK_ROWS) {
+        X.n_rows = test_view->n_samples - first < SCORE_BLOCK_ROWS ?
+                   test_view->n_samples - first : SCORE_BLOCK_ROWS;
+        for(uint32_t fid = 0; fid < prob->n_features; fid++) {
+            for(uint32_t r = 0; r < X.n_rows; r++) {
+                X.data[(size_t) fid * X.n_rows + r] =
+                    PROB_GET(prob, VIEW_SAMPLE(test_view, first + r), fid);
+            }
+        }
+        check(! ET_forest_predict_prefixes_batch(forest, &X, prefix_trees,
+                                                 n_prefixes, 1, n_threads,
+                                                 y),
+              "could not predict test samples");
+
+        for(uint32_t r = 0; r < X.n_rows; r++) {
+            uint32_t sample_idx = VIEW_SAMPLE(test_view, first + r);
+            uint32_t weight = SAMPLE_WEIGHT(prob->weights, sample_idx);
+            for(uint32_t p = 0; p < n_prefixes; p++) {
+                scores[p] += prediction_loss(regression,
+                                             y[(size_t) r * n_prefixes + p],
+                                             prob->labels[sample_idx]) *
+                             weight;
+            }
+            total_weight += weight;
+        }
+    }
+    for(uint32_t p = 0; p < n_prefixes; p++) scores[p] /= total_weight;
+    ret = 0;
+
+    exit:
+    if (X.data) free(X.data);
+    if (y) free(y);
+    return ret;
+}
+
+
+// --- cross validation ---
+
+typedef struct {
+    ET_problem_view *view;
+    ET_params *params;
+    uint32_t *folds;
+    double *scores;
+} cv_data;
+
+static int label_position_compare(const void *a, const void *b) {
+    const double *aa = a, *bb = b;
+    if (aa[0] < bb[0]) return -1;
+    if (aa[0] > bb[0]) return +1;
+    return (aa[1] > bb[1]) - (aa[1] < bb[1]);
+}
+
+// assign each sample of the view to a fold. Samples are shuffled and, if
+// stratified, grouped by label before being dealt to folds in turn.
+static uint32_t *assign_folds(ET_problem_view *view, uint32_t n_folds,
+                              bool stratified) {
+    uint32_t n_samples = view->n_samples;
+    uint32_t *folds = NULL, *perm = NULL;
+    double *label_position = NULL;
+    SimpleRandomKISS2_t rand_state;
+    uint32_t seed[4] = ET_DEFAULT_SEED;
+
+    simplerandom_kiss2_seed(&rand_state, seed[2], seed[3], seed[1], seed[0]);
+
+    perm = malloc(n_samples * sizeof(uint32_t));
+    check_mem(perm);
+    folds = malloc(n_samples * sizeof(uint32_t));
+    check_mem(folds);
+
+    for(uint32_t i = 0; i < n_samples; i++) perm[i] = i;
+    for(uint32_t i = n_samples - 1; i > 0; i--) {
+        uint32_t j = random_int(&rand_state, i + 1);
+        uint32_t tmp = perm[i];
+        perm[i] = perm[j];
+        perm[j] = tmp;
+    }
+
+    if (stratified) {
+        label_position = malloc(2 * n_samples * sizeof(double));
+        check_mem(label_position);
+        for(uint32_t i = 0; i < n_samples; i++) {
+            uint32_t sample_idx = VIEW_SAMPLE(view, perm[i]);
+            label_position[2 * i]     = view->prob->labels[sample_idx];
+            label_position[2 * i + 1] = i;
+        }
+        qsort(label_position, n_samples, 2 * sizeof(double),
+              label_position_compare);
+        for(uint32_t i = 0; i < n_samples; i++) {
+            folds[perm[(uint32_t) label_position[2 * i + 1]]] = i % n_folds;
+        }
+        free(label_position);
+    } else {
+        for(uint32_t i = 0; i < n_samples; i++) {
+            folds[perm[i]] = i % n_folds;
+        }
+    }
+
+    free(perm);
+    return folds;
+
+    exit:
+    if (perm) free(perm);
+    if (folds) free(folds);
+    return NULL;
+}
+
+static void cv_fold(uint32_t fold, cv_data *cvd) {
+    ET_forest *forest = NULL;
+    ET_problem_view *view = cvd->view;
+    ET_problem_view train_view, test_view;
+    uint_vec train_idxs, test_idxs;
+    uint32_t seed[4] = ET_DEFAULT_SEED;
+
+    kv_init(train_idxs);
+    kv_init(test_idxs);
+    cvd->scores[fold] = NAN;
+
+    for(uint32_t i = 0; i < view->n_samples; i++) {
+        if (cvd->folds[i] == fold) {
+            kv_push(uint32_t, test_idxs, VIEW_SAMPLE(view, i));
+        } else {
+            kv_push(uint32_t, train_idxs, VIEW_SAMPLE(view, i));
+        }
+    }
+    check(kv_size(train_idxs) && kv_size(test_idxs),
+          "fold #%d has no train or no test samples", fold);
+
+    train_view = *view;
+    train_view.sample_idxs = train_idxs.a;
+    train_view.n_samples = kv_size(train_idxs);
+
+    test_view = *view;
+    test_view.sample_idxs = test_idxs.a;
+    test_view.n_samples = kv_size(test_idxs);
+
+    forest = forest_build(&train_view, cvd->params, seed, NULL);
+    check_mem(forest);
+    if (forest_score(forest, &test_view, &forest->params.number_of_trees, 1,
+                     1, &cvd->scores[fold])) {
+        cvd->scores[fold] = NAN;
+    }
+
+    exit:
+    if (forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+    kv_destroy(train_idxs);
+    kv_destroy(test_idxs);
+}
+
+
+double *ET_forest_cross_validate(ET_problem *prob, ET_params *params,
+                                 uint32_t n_folds, bool stratified,
+                                 uint32_t n_threads) {
+    ET_problem_view view;
+    ET_problem_view_init(&view, prob);
+    return ET_forest_cross_validate_view(&view, params, n_folds, stratified,
+                                         n_threads);
+}
+
+
+double *ET_forest_cross_validate_view(ET_problem_view *view,
+                                      ET_params *params, uint32_t n_folds,
+                                      bool stratified, uint32_t n_threads) {
+    cv_data cvd = {view, params, NULL, NULL};
+
+    check(n_folds >= 2 && n_folds <= view->n_samples,
+          "invalid number of folds: %d", n_folds);
+
+    cvd.folds = assign_folds(view, n_folds, stratified);
+    check_mem(cvd.folds);
+    cvd.scores = malloc(n_folds * sizeof(double));
+    check_mem(cvd.scores);
+
+    parallel_run(n_threads, n_folds, (parallel_task) cv_fold, &cvd);
+
+    exit:
+    if (cvd.folds) free(cvd.folds);
+    return cvd.scores;
+}
+
+
+// --- hyperparameter sweep ---
+// configurations differing only in number_of_trees share one forest: the
+// first k trees of a forest are exactly the forest built with k trees.
+// The test rows of a group are scored by blocks through the batch API, all
+// the group's tree counts in one walk, and the blocks spread over threads.
+
+typedef struct {
+    ET_problem_view *train_view;
+    ET_problem_view *test_view;
+    ET_params *grid;
+    kvec_t(uint_vec) groups;
+    double *scores;
+    uint32_t n_score_threads;   // per group: the threads left by the groups
+} sweep_data;
+
+static bool same_params_but_trees(ET_params *a, ET_params *b) {
+    return a->number_of_features_tested == b->number_of_features_tested &&
+           a->regression == b->regression &&
+           a->single_precision == b->single_precision &&
+           a->mad_diversity == b->mad_diversity &&
+           a->min_split_size == b->min_split_size &&
+           a->select_features_with_replacement ==
+                                        b->select_features_with_replacement &&
+           a->class_sample_cap == b->class_sample_cap;
+}
+
+// insertion sort of the group configs by number of trees
+static void sort_group(uint_vec *group, ET_params *grid) {
+    for(size_t i = 1; i < kv_size(*group); i++) {
+        for(size_t j = i; j > 0 &&
+                          grid[kv_A(*group, j - 1)].number_of_trees >
+                          grid[kv_A(*group, j)].number_of_trees; j--) {
+            uint32_t tmp = kv_A(*group, j);
+            kv_A(*group, j) = kv_A(*group, j - 1);
+            kv_A(*group, j - 1) = tmp;
+        }
+    }
+}
+
+static void sweep_group(uint32_t group_idx, sweep_data *sd) {
+    uint_vec *group = &kv_A(sd->groups, group_idx);
+    ET_params params = sd->grid[kv_A(*group, 0)];
+    ET_forest *forest = NULL;
+    uint32_t *prefix_trees = NULL;
+    double *scores = NULL;
+    uint32_t seed[4] = ET_DEFAULT_SEED;
+
+    sort_group(group, sd->grid);
+    check(sd->grid[kv_A(*group, 0)].number_of_trees > 0,
+          "sweep configuration #%d has no trees", kv_A(*group, 0));
+    params.number_of_trees = sd->grid[kv_last(*group)].number_of_trees;
+
+    prefix_trees = malloc(kv_size(*group) * sizeof(uint32_t));
+    check_mem(prefix_trees);
+    scores = malloc(kv_size(*group) * sizeof(double));
+    check_mem(scores);
+    for(size_t i = 0; i < kv_size(*group); i++) {
+        prefix_trees[i] = sd->grid[kv_A(*group, i)].number_of_trees;
+    }
+
+    // every configuration is scored by the same walk of the trees
+    forest = forest_build(sd->train_view, &params, seed, NULL);
+    check_mem(forest);
+    check(! forest_score(forest, sd->test_view, prefix_trees,
+                         kv_size(*group), sd->n_score_threads, scores),
+          "could not score sweep group #%d", group_idx);
+    for(size_t i = 0; i < kv_size(*group); i++) {
+        sd->scores[kv_A(*group, i)] = scores[i];
+    }
+    goto cleanup;
+
+    exit:
+    for(size_t i = 0; i < kv_size(*group); i++) {
+        sd->scores[kv_A(*group, i)] = NAN;
+    }
+
+    cleanup:
+    if (forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+    if (prefix_trees) free(prefix_trees);
+    if (scores) free(scores);
+}
+
+
+double *ET_forest_sweep(ET_problem_view *train_view,
+                        ET_problem_view *test_view,
+                        ET_params *grid, uint32_t n_configs,
+                        uint32_t n_threads) {
+    sweep_data sd = {train_view, test_view, grid, {0, 0, NULL}, NULL, 1};
+
+    check(test_view->n_samples > 0, "empty test view");
+    sd.scores = malloc(n_configs * sizeof(double));
+    check_mem(sd.scores);
+
+    for(uint32_t config = 0; config < n_configs; config++) {
+        uint_vec *group = NULL;
+        for(size_t i = 0; i < kv_size(sd.groups); i++) {
+            uint32_t first = kv_A(kv_A(sd.groups, i), 0);
+            if (same_params_but_trees(&grid[first], &grid[config])) {
+                group = &kv_A(sd.groups, i);
+                break;
+            }
+        }
+        if (group == NULL) {
+            group = (kv_pushp(uint_vec, sd.groups));
+            kv_init(*group);
+        }
+        kv_push(uint32_t, *group, config);
+    }
+
+    // groups are built in parallel, and their test rows are scored in
+    // parallel on the threads they leave
+    if (n_threads > kv_size(sd.groups)) {
+        sd.n_score_threads = n_threads / kv_size(sd.groups);
+    }
+    parallel_run(n_threads, kv_size(sd.groups), (parallel_task) sweep_group,
+                 &sd);
+
+    exit:
+    for(size_t i = 0; i < kv_size(sd.groups); i++) {
+        kv_destroy(kv_A(sd.groups, i));
+    }
+    kv_destroy(sd.groups);
+    return sd.scores;
+}
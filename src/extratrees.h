@@ -13,13 +13,33 @@ typedef kvec_t(unsigned char) uchar_vec;
 
 // --- problem ---
 
+// element type of the (column major) feature matrix
+typedef enum {
+    ET_FLOAT32 = 0,
+    ET_FLOAT64,
+    ET_UINT8
+} ET_feature_type;
+
 typedef struct {
-    float *vectors;
+    void *vectors;
     double *labels;
+    uint32_t *weights;          // occurrences of each sample. NULL: all 1
     uint32_t n_features;
     uint32_t n_samples;
+    ET_feature_type feature_type;
 } ET_problem;
 
+// subset of the samples and features of a problem. Indexes refer to the
+// parent problem: a NULL index array selects all the samples (features).
+
+typedef struct {
+    ET_problem *prob;
+    uint32_t *sample_idxs;
+    uint32_t n_samples;
+    uint32_t *feature_idxs;
+    uint32_t n_features;
+} ET_problem_view;
+
 
 // --- params ---
 
@@ -27,8 +47,12 @@ typedef struct ET_params {
     uint32_t number_of_features_tested;
     uint32_t number_of_trees;
     bool regression;
+    bool single_precision;      // float labels, diversities and thresholds
+    bool mad_diversity;         // regression: absolute deviation from median
     uint32_t min_split_size;
     bool select_features_with_replacement;
+    uint32_t class_sample_cap;  // classification: max samples per class and
+                                // tree, counting weights, 0 to use them all
 } ET_params;
 
 
@@ -36,21 +60,32 @@ typedef struct ET_params {
     (params).number_of_features_tested = ceil(sqrt((prob).n_features));  \
     (params).number_of_trees           = 100;                            \
     (params).regression                = false;                          \
+    (params).single_precision          = false;                          \
+    (params).mad_diversity             = false;                          \
     (params).min_split_size            = 2;                              \
     (params).select_features_with_replacement = false;                   \
+    (params).class_sample_cap          = 0;                              \
     } while(0)
 
 # define EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params) do {               \
     (params).number_of_features_tested = (prob).n_features;              \
     (params).number_of_trees           = 100;                            \
     (params).regression                = true;                           \
+    (params).single_precision          = false;                          \
+    (params).mad_diversity             = false;                          \
     (params).min_split_size            = 2;                              \
     (params).select_features_with_replacement = false;                   \
+    (params).class_sample_cap          = 0;                              \
     } while(0)
 
 
 // --- tree ---
 
+#ifndef ET_CLASS_COUNTER
+#define ET_CLASS_COUNTER
+typedef struct ET_class_counter_struct ET_class_counter;
+#endif
+
 #define ET_LEAF_NODE 'L'
 #define ET_SPLIT_NODE 'S'
 
@@ -65,23 +100,30 @@ typedef struct ET_split_node {
     float threshold;
     uint32_t feature_id;
     ET_base_node *lower_node, *higher_node;
+    // aggregates of the leaves below, optionally set by
+    // ET_forest_summarize_splits. The count is base.n_samples
+    bool summarized;
+    double label_sum;           // weighted
+    ET_class_counter *classes;  // weighted, classification forests only
 } ET_split_node;
 
 typedef struct ET_leaf_node {
     ET_base_node base;
     bool constant;
     uint_vec indexes;
+    // aggregates of the labels of indexes, set by ET_tree_summarize
+    bool summarized;
+    double label_sum;           // weighted
+    double label;               // constant leaves: their label, weighing
+                                // base.n_samples
+    ET_class_counter *classes;  // weighted, mixed leaves of classification
+                                // forests only
 } ET_leaf_node;
 
 typedef ET_base_node *ET_tree;
 
 // --- forest ---
 
-#ifndef ET_CLASS_COUNTER
-#define ET_CLASS_COUNTER
-typedef struct ET_class_counter_struct ET_class_counter;
-#endif
-
 typedef kvec_t(ET_tree) tree_vec;
 
 typedef struct {
@@ -90,10 +132,38 @@ typedef struct {
     tree_vec trees;
     ET_params params;
     double *labels;
+    uint32_t *weights;          // NULL if trained on all the samples of an
+                                // unweighted problem, 0 outside the view
+    double_vec class_correction; // (label, factor) pairs undoing the prior
+                                 // shift of class_sample_cap, or empty
     ET_class_counter *class_frequency;
+    uint32_t *label_order;      // sample indexes by increasing label, equal
+                                // labels by sample index
+    uint32_t *label_ranks;      // position of each sample in label_order
+    bool splits_summarized;     // by ET_forest_summarize_splits: trees
+                                // loaded or merged later are summarized too
 } ET_forest;
 
 
+// --- training stats ---
+
+typedef struct {
+    double total_time;            // wall time in seconds
+    double_vec tree_time;         // wall time per tree
+    double random_time;           // feature and threshold selection
+    double min_max_time;          // get_feature_min_max
+    double split_time;            // split_on_threshold
+    double diversity_time;        // diversity_f
+    double alloc_time;            // node creation and index copies
+    uint64_t n_nodes;
+    uint64_t n_leaves;
+    uint64_t n_candidate_splits;
+    uint64_t n_samples_scanned;
+    uint64_t n_constant_features;
+    uint64_t bytes_allocated;
+} ET_train_stats;
+
+
 // --- predict types ---
 
 typedef struct {
@@ -104,25 +174,193 @@ typedef struct {
 typedef kvec_t(class_probability) class_probability_vec;
 
 
+// dense matrix of samples: feature fid of sample row is at
+// data[row * n_columns + fid], or at data[fid * n_rows + row] if column_major
+
+typedef struct {
+    float *data;
+    uint32_t n_rows;
+    uint32_t n_columns;
+    bool column_major;
+} ET_matrix;
+
+
+// --- partial aggregates ---
+// predictions over the tree range [tree_begin, tree_end). Partials over
+// adjacent ranges can be combined and finalized to the whole forest value.
+
+typedef struct {
+    uint32_t tree_begin, tree_end;
+    double sum;                  // sum of tree predictions
+    double compensation;         // rounding error of sum
+} ET_regression_partial;
+
+typedef struct {
+    double label;
+    uint32_t votes;              // trees voting label (ties excluded)
+    uint32_t first_vote;         // first tree voting label
+    double probability_sum;      // sum of label frequencies in tree leaves
+    double compensation;         // rounding error of probability_sum
+} ET_class_partial_elm;
+
+typedef kvec_t(ET_class_partial_elm) class_partial_elm_vec;
+
+typedef struct {
+    uint32_t tree_begin, tree_end;
+    class_partial_elm_vec classes;
+    uint_vec tie_trees;          // trees with tied classes, in tree order
+    uint_vec tie_offsets;        // start of each tie in tie_classes
+    double_vec tie_classes;
+} ET_class_partial;
+
+
+// --- neighbors ---
+// training samples reaching the leaves of a vector, weighted as by
+// ET_forest_neighbors, without a dense n_samples array
+
+typedef struct {
+    uint32_t sample_idx;
+    double weight;
+} ET_neighbor;
+
+typedef kvec_t(ET_neighbor) neighbor_vec;
+
+// neighbors of the rows of a matrix, compressed by row: those of row r are
+// [row_offsets[r], row_offsets[r + 1]) in sample_idxs and weights
+typedef struct {
+    uint32_t n_rows;
+    size_t *row_offsets;
+    uint_vec sample_idxs;
+    double_vec weights;
+} ET_neighbors_csr;
+
+
+// --- prediction context ---
+// scratch buffers of single vector predictions, reused from call to call
+// by the _ctx functions: once they have grown to fit the forest, those
+// predictions do not allocate. Returned vectors belong to the context and
+// are overwritten by its next use. One context per thread.
+
+typedef struct {
+    ET_class_counter *counts;       // classes of a curtailed lookup
+    ET_class_partial partial;
+    class_partial_elm_vec votes;
+    class_probability_vec probabilities;
+    uint_vec neighbors;             // samples reached in one tree
+    double_vec neighbor_weights;    // n_samples, 0 but for touched
+    uint_vec touched;
+    double_vec quantile_values;     // cumulated weights of ranked neighbors
+    neighbor_vec sparse_neighbors;
+    neighbor_vec neighbor_scratch;  // radix sort of sparse_neighbors
+    uint_vec neighbor_slots;        // hash of (sample index, index + 1 in
+                                    // sparse_neighbors) pairs
+} ET_predict_ctx;
+
+
+// --- quickscorer ---
+// forests whose trees have at most 64 leaves, scored feature by feature:
+// the split conditions of all the trees on a feature are sorted by
+// threshold, and each failed condition clears the leaves of its lower
+// subtree from the bitvector of its tree. Equal to ET_forest_predict.
+
+typedef struct {
+    ET_forest *forest;          // must outlive the quickscorer
+    uint32_t *feature_offsets;  // conditions on feature fid are
+                                // [feature_offsets[fid], [fid + 1])
+    float *thresholds;          // ascending for each feature
+    uint32_t *condition_trees;
+    uint64_t *condition_masks;  // leaves kept if x > threshold
+    uint32_t *leaf_offsets;     // first leaf of each tree
+    double *leaf_values;        // regression forests
+    ET_class_counter **leaf_classes;
+} ET_quickscorer;
+
+
 // --- functions ---
 
 ET_problem *ET_load_libsvm_file(char *fname);
 ET_forest *ET_forest_build(ET_problem *prob, ET_params *params);
+ET_forest *ET_forest_build_stats(ET_problem *prob, ET_params *params,
+                                 ET_train_stats *stats);
+ET_forest *ET_forest_build_view(ET_problem_view *view, ET_params *params,
+                                ET_train_stats *stats);
+ET_forest *ET_forest_build_multiprocess(ET_problem *prob, ET_params *params,
+                                        uint32_t n_workers);
+ET_forest *ET_forest_build_multiprocess_view(ET_problem_view *view,
+                                             ET_params *params,
+                                             uint32_t n_workers);
+int ET_forest_merge(ET_forest *forest, ET_forest *other);
+double *ET_forest_cross_validate(ET_problem *prob, ET_params *params,
+                                 uint32_t n_folds, bool stratified,
+                                 uint32_t n_threads);
+double *ET_forest_cross_validate_view(ET_problem_view *view,
+                                      ET_params *params, uint32_t n_folds,
+                                      bool stratified, uint32_t n_threads);
+double *ET_forest_sweep(ET_problem_view *train_view,
+                        ET_problem_view *test_view,
+                        ET_params *grid, uint32_t n_configs,
+                        uint32_t n_threads);
+void ET_train_stats_init(ET_train_stats *stats);
+void ET_train_stats_destroy(ET_train_stats *stats);
+void ET_train_stats_print(ET_train_stats *stats, FILE *f);
 double *ET_forest_feature_importance(ET_forest *forest,
                                      uint32_t curtail_min_size);
 void ET_forest_destroy(ET_forest *forest);
 void ET_forest_dump(ET_forest *forest, uchar_vec *buffer, bool with_trees);
 ET_forest *ET_forest_load(unsigned char **bufferp);
 ET_tree ET_tree_load(unsigned char **bufferp);
+int ET_tree_summarize(ET_forest *forest, ET_tree tree);
+int ET_forest_summarize_splits(ET_forest *forest);
 void ET_tree_dump(ET_tree tree, uchar_vec *buffer);
 void ET_problem_print(ET_problem *prob, FILE *f);
 void ET_problem_destroy(ET_problem *prob);
+ET_problem *ET_problem_collapse(ET_problem *prob);
+void ET_problem_view_init(ET_problem_view *view, ET_problem *prob);
+int ET_problem_view_init_informative(ET_problem_view *view,
+                                     ET_problem *prob, uint32_t n_threads);
+void ET_problem_view_destroy(ET_problem_view *view);
 
 double ET_forest_predict(ET_forest *forest, float *vector);
+int ET_forest_codegen(ET_forest *forest, const char *name, FILE *f);
+
+int ET_predict_ctx_init(ET_predict_ctx *ctx);
+void ET_predict_ctx_destroy(ET_predict_ctx *ctx);
+double ET_forest_predict_ctx(ET_forest *forest, float *vector,
+                             ET_predict_ctx *ctx);
+double ET_forest_predict_class_majority_ctx(ET_forest *forest, float *vector,
+                                            uint32_t curtail_min_size,
+                                            ET_predict_ctx *ctx);
+double ET_forest_predict_class_bayes_ctx(ET_forest *forest, float *vector,
+                                         uint32_t curtail_min_size,
+                                         bool smooth, ET_predict_ctx *ctx);
+class_probability_vec *ET_forest_predict_probability_ctx(ET_forest *forest,
+                                                 float *vector,
+                                                 uint32_t curtail_min_size,
+                                                 bool smooth,
+                                                 ET_predict_ctx *ctx);
+double *ET_forest_neighbors_ctx(ET_forest *forest, float *vector,
+                                uint32_t curtail_min_size,
+                                ET_predict_ctx *ctx);
+double ET_forest_predict_quantile_ctx(ET_forest *forest, float *vector,
+                                      double quantile,
+                                      uint32_t curtail_min_size,
+                                      ET_predict_ctx *ctx);
+void ET_forest_predict_quantiles_ctx(ET_forest *forest, float *vector,
+                                     double *quantiles, uint32_t n_quantiles,
+                                     uint32_t curtail_min_size,
+                                     ET_predict_ctx *ctx, double *y);
+neighbor_vec *ET_forest_neighbors_sparse_ctx(ET_forest *forest, float *vector,
+                                             uint32_t curtail_min_size,
+                                             uint32_t top_k,
+                                             ET_predict_ctx *ctx);
 double ET_forest_predict_regression(ET_forest *forest, float *v,
                                     uint32_t curtail_min_size);
 double ET_forest_predict_quantile(ET_forest *forest, float *v, double quantile,
                                     uint32_t curtail_min_size);
+// the n_quantiles quantiles of one lookup of the vector
+int ET_forest_predict_quantiles(ET_forest *forest, float *vector,
+                                double *quantiles, uint32_t n_quantiles,
+                                uint32_t curtail_min_size, double *y);
 double ET_forest_predict_class_majority(ET_forest *forest, float *v,
                                         uint32_t curtail_min_size);
 double ET_forest_predict_class_bayes(ET_forest *forest, float *v,
@@ -133,5 +371,72 @@ class_probability_vec *ET_forest_predict_probability(ET_forest *forest,
                                                     float *vector,
                                                     uint32_t curtail_min_size,
                                                     bool smooth);
+// sorted by sample index. With top_k > 0, only the top_k heaviest (lowest
+// sample index first among equal weights)
+neighbor_vec *ET_forest_neighbors_sparse(ET_forest *forest, float *vector,
+                                         uint32_t curtail_min_size,
+                                         uint32_t top_k);
+// quantiles of row r at y[r * n_quantiles], [r * n_quantiles + 1]...
+int ET_forest_predict_quantiles_batch(ET_forest *forest, ET_matrix *X,
+                                      double *quantiles, uint32_t n_quantiles,
+                                      uint32_t curtail_min_size,
+                                      uint32_t n_threads, double *y);
+int ET_forest_neighbors_batch(ET_forest *forest, ET_matrix *X,
+                              uint32_t curtail_min_size, uint32_t top_k,
+                              uint32_t n_threads, ET_neighbors_csr *csr);
+void ET_neighbors_csr_destroy(ET_neighbors_csr *csr);
+
+// batch prediction: one output per row of X, on n_threads threads, equal
+// to the single vector functions. Probabilities are written row after row,
+// a column per class of ET_forest_classes
+double_vec *ET_forest_classes(ET_forest *forest);
+int ET_forest_predict_regression_batch(ET_forest *forest, ET_matrix *X,
+                                       uint32_t curtail_min_size,
+                                       uint32_t n_threads, double *y);
+int ET_forest_predict_class_majority_batch(ET_forest *forest, ET_matrix *X,
+                                           uint32_t curtail_min_size,
+                                           uint32_t n_threads, double *y);
+int ET_forest_predict_class_bayes_batch(ET_forest *forest, ET_matrix *X,
+                                        uint32_t curtail_min_size,
+                                        bool smooth, uint32_t n_threads,
+                                        double *y);
+int ET_forest_predict_probability_batch(ET_forest *forest, ET_matrix *X,
+                                        uint32_t curtail_min_size,
+                                        bool smooth, uint32_t n_threads,
+                                        double *probabilities);
+// regression or class majority of the forests made of the first
+// prefix_trees[p] trees, in increasing order: y[row * n_prefixes + p]
+int ET_forest_predict_prefixes_batch(ET_forest *forest, ET_matrix *X,
+                                     uint32_t *prefix_trees,
+                                     uint32_t n_prefixes,
+                                     uint32_t curtail_min_size,
+                                     uint32_t n_threads, double *y);
+
+ET_quickscorer *ET_quickscorer_new(ET_forest *forest);
+void ET_quickscorer_destroy(ET_quickscorer *qs);
+double ET_quickscorer_predict(ET_quickscorer *qs, float *vector);
+int ET_quickscorer_predict_batch(ET_quickscorer *qs, ET_matrix *X,
+                                 double *y);
+
+void ET_forest_partial_regression(ET_forest *forest, float *vector,
+                                  uint32_t curtail_min_size,
+                                  uint32_t tree_begin, uint32_t tree_end,
+                                  ET_regression_partial *partial);
+int ET_regression_partial_combine(ET_regression_partial *partial,
+                                  ET_regression_partial *other);
+double ET_regression_partial_value(ET_regression_partial *partial);
+
+void ET_class_partial_init(ET_class_partial *partial);
+void ET_class_partial_destroy(ET_class_partial *partial);
+int ET_forest_partial_classification(ET_forest *forest, float *vector,
+                                     uint32_t curtail_min_size,
+                                     uint32_t tree_begin, uint32_t tree_end,
+                                     ET_class_partial *partial);
+int ET_class_partial_combine(ET_class_partial *partial,
+                             ET_class_partial *other);
+double ET_class_partial_majority(ET_class_partial *partial);
+class_probability_vec *ET_class_partial_probability(ET_forest *forest,
+                                                    ET_class_partial *partial,
+                                                    bool smooth);
 
 # endif
@@ -221,6 +221,8 @@ ET_problem *ET_load_libsvm_file(char *fname) {
     prob->labels  = lp->labels;
     prob->n_features = sp->n_features;
     prob->n_samples  = sp->n_samples;
+    prob->feature_type = ET_FLOAT32;
+    prob->weights = NULL;
 
     exit:
     if (sp) {
@@ -0,0 +1,180 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "extratrees.h"
+#include "train.h"
+#include "log.h"
+
+
+// Each worker is a forked process. The problem (and the view indexes) are
+// never copied: workers read the parent's vectors and labels through the
+// pages shared with it at fork time (they are only read, so copy-on-write
+// never triggers).
+// Trees come back to the parent serialized through a pipe.
+
+
+static int write_all(int fd, void *data, size_t n) {
+    unsigned char *p = data;
+    while (n) {
+        ssize_t written = write(fd, p, n);
+        if (written <= 0) return -1;
+        p += written;
+        n -= written;
+    }
+    return 0;
+}
+
+static int read_all(int fd, void *data, size_t n) {
+    unsigned char *p = data;
+    while (n) {
+        ssize_t nread = read(fd, p, n);
+        if (nread <= 0) return -1;
+        p += nread;
+        n -= nread;
+    }
+    return 0;
+}
+
+
+static void shard_seed(uint32_t shard, uint32_t *seed) {
+    uint32_t base[4] = ET_DEFAULT_SEED;
+    for(int i = 0; i < 4; i++) {
+        seed[i] = base[i] + shard * 0x9E3779B9u;
+    }
+}
+
+
+static void run_worker(ET_problem_view *view, ET_params *params,
+                       uint32_t shard, int fd) {
+    ET_forest *forest = NULL;
+    uchar_vec buffer;
+    uint64_t size = 0;
+    uint32_t seed[4];
+    int status = 1;
+
+    kv_init(buffer);
+    shard_seed(shard, seed);
+
+    forest = forest_build(view, params, seed, NULL);
+    check_mem(forest);
+
+    ET_forest_dump(forest, &buffer, true);
+    size = kv_size(buffer);
+    status = 0;
+
+    exit:
+    if (write_all(fd, &size, sizeof(size)) ||
+        write_all(fd, buffer.a, size)) {
+        status = 1;
+    }
+    close(fd);
+    _exit(status);
+}
+
+
+static ET_forest *receive_shard(int fd) {
+    ET_forest *forest = NULL;
+    unsigned char *buffer = NULL, *mobile_buffer;
+    uint64_t size;
+
+    check(! read_all(fd, &size, sizeof(size)), "worker pipe closed");
+    check(size > 0, "worker failed to build its shard");
+
+    buffer = malloc(size);
+    check_mem(buffer);
+    check(! read_all(fd, buffer, size), "worker pipe closed");
+
+    mobile_buffer = buffer;
+    forest = ET_forest_load(&mobile_buffer);
+
+    exit:
+    if (buffer) free(buffer);
+    return forest;
+}
+
+
+ET_forest *ET_forest_build_multiprocess(ET_problem *prob, ET_params *params,
+                                        uint32_t n_workers) {
+    ET_problem_view view;
+    ET_problem_view_init(&view, prob);
+    return ET_forest_build_multiprocess_view(&view, params, n_workers);
+}
+
+
+ET_forest *ET_forest_build_multiprocess_view(ET_problem_view *view,
+                                             ET_params *params,
+                                             uint32_t n_workers) {
+    ET_forest *forest = NULL, *shard_forest = NULL;
+    pid_t *pids = NULL;
+    int *fds = NULL;
+    uint32_t n_trees = params->number_of_trees;
+    uint32_t n_started = 0;
+    bool error = true;
+
+    if (n_workers > n_trees) n_workers = n_trees;
+    if (n_workers < 1) n_workers = 1;
+
+    pids = calloc(n_workers, sizeof(pid_t));
+    check_mem(pids);
+    fds = calloc(n_workers, sizeof(int));
+    check_mem(fds);
+
+    for(uint32_t shard = 0; shard < n_workers; shard++) {
+        int pipe_fds[2];
+        ET_params shard_params = *params;
+        shard_params.number_of_trees = n_trees / n_workers +
+                                       (shard < n_trees % n_workers);
+
+        check(! pipe(pipe_fds), "could not create worker pipe");
+        pids[shard] = fork();
+        if (pids[shard] == 0) {
+            close(pipe_fds[0]);
+            run_worker(view, &shard_params, shard, pipe_fds[1]);
+        }
+        close(pipe_fds[1]);
+        if (pids[shard] < 0) {
+            // no worker to wait for: only the read end is left to close
+            close(pipe_fds[0]);
+            sentinel("could not fork worker #%d", shard);
+        }
+        fds[shard] = pipe_fds[0];
+        n_started++;
+    }
+
+    error = false;
+    for(uint32_t shard = 0; shard < n_workers; shard++) {
+        shard_forest = receive_shard(fds[shard]);
+        if (shard_forest == NULL) {
+            error = true;
+        } else if (forest == NULL) {
+            forest = shard_forest;
+        } else {
+            if (ET_forest_merge(forest, shard_forest)) error = true;
+            ET_forest_destroy(shard_forest);
+            free(shard_forest);
+        }
+    }
+
+    exit:
+    for(uint32_t shard = 0; shard < n_started; shard++) {
+        int status;
+        close(fds[shard]);
+        if (waitpid(pids[shard], &status, 0) < 0 ||
+            ! WIFEXITED(status) || WEXITSTATUS(status)) {
+            log_error("worker #%d failed", shard);
+            error = true;
+        }
+    }
+    if (error && forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+        forest = NULL;
+    }
+    if (pids) free(pids);
+    if (fds) free(fds);
+    return forest;
+}
@@ -0,0 +1,62 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+#include "log.h"
+
+
+// tasks are handed out one at a time, so uneven tasks still balance.
+// The calling thread takes part in the work: if threads cannot be
+// started the remaining tasks simply run sequentially.
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t next_task;
+    uint32_t n_tasks;
+    parallel_task f;
+    void *data;
+} task_queue;
+
+
+static void *worker(void *arg) {
+    task_queue *queue = arg;
+
+    while (1) {
+        uint32_t task_idx;
+
+        pthread_mutex_lock(&queue->lock);
+        task_idx = queue->next_task++;
+        pthread_mutex_unlock(&queue->lock);
+
+        if (task_idx >= queue->n_tasks) break;
+        queue->f(task_idx, queue->data);
+    }
+    return NULL;
+}
+
+
+void parallel_run(uint32_t n_threads, uint32_t n_tasks, parallel_task f,
+                  void *data) {
+    task_queue queue = {PTHREAD_MUTEX_INITIALIZER, 0, n_tasks, f, data};
+    pthread_t *threads = NULL;
+    uint32_t n_started = 0;
+
+    if (n_threads > n_tasks) n_threads = n_tasks;
+
+    if (n_threads > 1) {
+        threads = malloc((n_threads - 1) * sizeof(pthread_t));
+        check_mem(threads);
+        for(; n_started < n_threads - 1; n_started++) {
+            check(! pthread_create(&threads[n_started], NULL, worker,
+                                   &queue),
+                  "could not start thread #%d", n_started);
+        }
+    }
+
+    exit:
+    worker(&queue);
+    for(uint32_t i = 0; i < n_started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    if (threads) free(threads);
+}
@@ -0,0 +1,11 @@
+#ifndef ET_PARALLEL_H
+#define ET_PARALLEL_H
+
+#include <stdint.h>
+
+typedef void (*parallel_task)(uint32_t task_idx, void *data);
+
+void parallel_run(uint32_t n_threads, uint32_t n_tasks, parallel_task f,
+                  void *data);
+
+#endif
@@ -1,20 +1,43 @@
+#include <string.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define LANES_AVX2 1
+#include <immintrin.h>
+#else
+#define LANES_AVX2 0
+#endif
+
 #include "extratrees.h"
 #include "util.h"
 #include "log.h"
 #include "counter.h"
+#include "problem.h"
+#include "parallel.h"
+#include "predict.h"
 
 
-static int compute_class_frequency(ET_forest *forest) {
+// needs label_order: equal labels are counted in one run, already sorted
+int compute_class_frequency(ET_forest *forest) {
     ET_class_counter *cc = NULL;
     cc = ET_class_counter_new();
     check_mem(cc);
 
-    for(size_t i = 0; i < forest->n_samples; i++) {
-        ET_class_counter_incr(cc, forest->labels[i]);
+    for(uint32_t rank = 0; rank < forest->n_samples; rank++) {
+        uint32_t sample_idx = forest->label_order[rank];
+        uint32_t weight = SAMPLE_WEIGHT(forest->weights, sample_idx);
+        double label = forest->labels[sample_idx];
+        size_t n_classes = kv_size(*cc);
+
+        // samples of weight 0 were not in the training view
+        if (weight == 0) continue;
+        if (n_classes && kv_A(*cc, n_classes - 1).key == label) {
+            kv_A(*cc, n_classes - 1).count += weight;
+        } else {
+            kv_push(class_counter_elm, *cc,
+                    ((class_counter_elm) {label, weight}));
+        }
     }
 
-    ET_class_counter_sort(cc);
-
     forest->class_frequency = cc;
     return 0;
 
@@ -23,52 +46,238 @@ static int compute_class_frequency(ET_forest *forest) {
 }
 
 
-// --- tree prediction utils ---
-
 typedef struct {
-    node_processor f;
-    void *data;
-} filter_leaves_data;
+    double label;
+    uint32_t sample_idx;
+} label_sample;
+
+static int label_sample_compare(const void *a, const void *b) {
+    const label_sample *aa = a, *bb = b;
+    if (aa->label < bb->label) return -1;
+    if (aa->label > bb->label) return +1;
+    return (aa->sample_idx > bb->sample_idx) -
+           (aa->sample_idx < bb->sample_idx);
+}
+
+int compute_label_order(ET_forest *forest) {
+    label_sample *ls = NULL;
 
-static void filter_leaves(ET_base_node *node, filter_leaves_data *fld) {
-    if IS_LEAF(node) {
-        fld->f(node, fld->data);
+    ls = malloc(forest->n_samples * sizeof(label_sample));
+    check_mem(ls);
+    forest->label_order = malloc(forest->n_samples * sizeof(uint32_t));
+    check_mem(forest->label_order);
+    forest->label_ranks = malloc(forest->n_samples * sizeof(uint32_t));
+    check_mem(forest->label_ranks);
+
+    for(uint32_t i = 0; i < forest->n_samples; i++) {
+        ls[i].label = forest->labels[i];
+        ls[i].sample_idx = i;
+    }
+    qsort(ls, forest->n_samples, sizeof(label_sample), label_sample_compare);
+    for(uint32_t rank = 0; rank < forest->n_samples; rank++) {
+        forest->label_order[rank] = ls[rank].sample_idx;
+        forest->label_ranks[ls[rank].sample_idx] = rank;
     }
+
+    free(ls);
+    return 0;
+
+    exit:
+    if (ls) free(ls);
+    return -1;
 }
 
-static void tree_lookup(ET_tree tree, float *vector, uint32_t curtail_min_size,
-                        node_processor f, void *data) {
 
+// --- tree prediction utils ---
+
+// node where the lookup of vector ends: a leaf, or the split node whose
+// next node has less than curtail_min_size samples. Feature fid of the
+// vector is vector[fid * stride]
+ET_base_node *tree_descend(ET_tree tree, float *vector, size_t stride,
+                           uint32_t curtail_min_size) {
     ET_base_node *node = tree;
-    filter_leaves_data fld;
 
     while(1) {
         switch(node->type) {
             case ET_SPLIT_NODE: {
                 ET_base_node *next_node = NULL;
                 ET_split_node *split = CAST_SPLIT(node);
-                next_node = (vector[split->feature_id] <= split->threshold) ?
+                next_node = (vector[split->feature_id * stride] <=
+                             split->threshold) ?
                              split->lower_node : split->higher_node;
                 if (next_node->n_samples < curtail_min_size)
-                    goto curtail;
+                    return node;
                 node = next_node;
                 break;
             }
-            case ET_LEAF_NODE: {
-                f(node, data);
-                return;
-            }
+            case ET_LEAF_NODE:
+                return node;
             default:
                 sentinel("unexpected split type %c", node->type);
         }
     }
 
-    curtail:
-    fld = (filter_leaves_data) {f, data};
-    tree_navigate(node, (node_processor) filter_leaves, &fld);
-
     exit:
-    return;
+    return node;
+}
+
+// the leaves below the node where a lookup ended, higher subtrees first as
+// in tree_navigate. Recursive so that lookups do not allocate a stack
+static void end_node_leaves(ET_base_node *node, node_processor f,
+                            void *data) {
+    if (IS_LEAF(node)) {
+        f(node, data);
+    } else if (IS_SPLIT(node)) {
+        end_node_leaves(CAST_SPLIT(node)->higher_node, f, data);
+        end_node_leaves(CAST_SPLIT(node)->lower_node, f, data);
+    }
+}
+
+static void tree_lookup(ET_tree tree, float *vector, size_t stride,
+                        uint32_t curtail_min_size,
+                        node_processor f, void *data) {
+    end_node_leaves(tree_descend(tree, vector, stride, curtail_min_size),
+                    f, data);
+}
+
+
+// * lanes
+// LANES rows descend a tree together: each step compares the feature of
+// every active lane with the threshold of its node, then moves the lanes
+// by the bits of the comparison mask. The next nodes of all the lanes are
+// prefetched at once, so their loads overlap instead of being chased one
+// row at a time. Each lane ends where tree_descend would.
+// On x86-64 the walk is also compiled for AVX2, whose gathers load the
+// features of the lanes at once, and chosen at run time if the CPU has it
+// and ET_NO_AVX2 is not set in the environment.
+
+#ifdef __GNUC__
+#define PREFETCH(p) __builtin_prefetch(p)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define PREFETCH(p)
+#define ALWAYS_INLINE inline
+#endif
+
+typedef uint32_t (*lanes_compare_function)(float **rows, int64_t *offsets,
+                                           float *thresholds);
+
+// bit l set if the feature of lane l is <= its threshold. NaN compares
+// false, as in tree_descend. Feature fid of lane l is at rows[0] + offsets[l]
+static ALWAYS_INLINE uint32_t lanes_compare(float **rows, int64_t *offsets,
+                                            float *thresholds) {
+    uint32_t mask = 0;
+    for(uint32_t l = 0; l < LANES; l++) {
+        mask |= (uint32_t) (rows[0][offsets[l]] <= thresholds[l]) << l;
+    }
+    return mask;
+}
+
+#if LANES_AVX2
+__attribute__((target("avx2")))
+static ALWAYS_INLINE uint32_t lanes_compare_avx2(float **rows,
+                                                 int64_t *offsets,
+                                                 float *thresholds) {
+    __m128 x_low = _mm256_i64gather_ps(rows[0],
+                        _mm256_loadu_si256((__m256i *) offsets), 4);
+    __m128 x_high = _mm256_i64gather_ps(rows[0],
+                        _mm256_loadu_si256((__m256i *) (offsets + 4)), 4);
+    __m128 le_low = _mm_cmp_ps(x_low, _mm_loadu_ps(thresholds), _CMP_LE_OQ);
+    __m128 le_high = _mm_cmp_ps(x_high, _mm_loadu_ps(thresholds + 4),
+                                _CMP_LE_OQ);
+    return _mm_movemask_ps(le_low) | (_mm_movemask_ps(le_high) << 4);
+}
+#endif
+
+// end nodes of rows[0, n_lanes) in tree. The rows are in the same matrix:
+// lane l reads feature fid at rows[l][fid * stride]. Inlined with a
+// constant compare, once per instruction set
+static ALWAYS_INLINE void descend_lanes(ET_tree tree, float **rows,
+                                        size_t stride,
+                                        uint32_t curtail_min_size,
+                                        uint32_t n_lanes,
+                                        ET_base_node **ends,
+                                        lanes_compare_function compare) {
+    ET_base_node *nodes[LANES];
+    int64_t offsets[LANES];
+    float thresholds[LANES];
+    uint32_t active = 0;
+
+    // finished lanes compare row 0 with +inf: a valid, unused read
+    for(uint32_t l = 0; l < LANES; l++) {
+        nodes[l] = tree;
+        offsets[l] = 0;
+        thresholds[l] = INFINITY;
+        if (l < n_lanes) active |= 1u << l;
+    }
+
+    while (active) {
+        uint32_t le;
+
+        for(uint32_t l = 0; l < n_lanes; l++) {
+            ET_split_node *split;
+            if (! (active & (1u << l))) continue;
+            if (IS_LEAF(nodes[l])) {
+                ends[l] = nodes[l];
+                active &= ~(1u << l);
+                offsets[l] = 0;
+                thresholds[l] = INFINITY;
+                continue;
+            }
+            split = CAST_SPLIT(nodes[l]);
+            offsets[l] = (rows[l] - rows[0]) +
+                         (int64_t) split->feature_id * stride;
+            thresholds[l] = split->threshold;
+        }
+
+        le = compare(rows, offsets, thresholds);
+        for(uint32_t l = 0; l < n_lanes; l++) {
+            ET_split_node *split;
+            ET_base_node *next_node;
+            if (! (active & (1u << l))) continue;
+            split = CAST_SPLIT(nodes[l]);
+            next_node = (le & (1u << l)) ? split->lower_node :
+                                           split->higher_node;
+            if (next_node->n_samples < curtail_min_size) {
+                ends[l] = nodes[l];
+                active &= ~(1u << l);
+                offsets[l] = 0;
+                thresholds[l] = INFINITY;
+                continue;
+            }
+            PREFETCH(next_node);
+            nodes[l] = next_node;
+        }
+    }
+}
+
+static void tree_descend_lanes(ET_tree tree, float **rows, size_t stride,
+                               uint32_t curtail_min_size, uint32_t n_lanes,
+                               ET_base_node **ends) {
+    descend_lanes(tree, rows, stride, curtail_min_size, n_lanes, ends,
+                  lanes_compare);
+}
+
+#if LANES_AVX2
+__attribute__((target("avx2")))
+static void tree_descend_lanes_avx2(ET_tree tree, float **rows,
+                                    size_t stride,
+                                    uint32_t curtail_min_size,
+                                    uint32_t n_lanes, ET_base_node **ends) {
+    descend_lanes(tree, rows, stride, curtail_min_size, n_lanes, ends,
+                  lanes_compare_avx2);
+}
+#endif
+
+lanes_descend_function lanes_descend(bool allow_avx2) {
+#if LANES_AVX2
+    if (allow_avx2 && ! getenv("ET_NO_AVX2") &&
+        __builtin_cpu_supports("avx2")) {
+        return tree_descend_lanes_avx2;
+    }
+#endif
+    UNUSED(allow_avx2);
+    return tree_descend_lanes;
 }
 
 
@@ -89,7 +298,7 @@ static uint_vec *tree_neighbors(ET_tree tree, float *vector,
     check_mem(sample_idxs);
     kv_init(*sample_idxs);
 
-    tree_lookup(tree, vector, curtail_min_size,
+    tree_lookup(tree, vector, 1, curtail_min_size,
                 (node_processor) append_neighbors, sample_idxs);
 
     exit:
@@ -102,12 +311,15 @@ typedef struct {
     double sum;
     uint32_t count;
     double *labels;
+    uint32_t *weights;
 } sum_count;
 
 static void regression_node_processor(ET_base_node *node, sum_count *sc) {
     ET_leaf_node *lf = CAST_LEAF(node);
 
-    if (lf->constant) {
+    if (lf->summarized) {
+        sc->sum += lf->label_sum;
+    } else if (lf->constant) {
         uint32_t first_sample_idx = kv_A(lf->indexes, 0);
         double label = sc->labels[first_sample_idx];
         sc->sum += label * node->n_samples;
@@ -115,17 +327,20 @@ static void regression_node_processor(ET_base_node *node, sum_count *sc) {
         for(size_t i = 0; i < kv_size(lf->indexes); i++) {
             uint32_t sample_idx = kv_A(lf->indexes, i);
             double label = sc->labels[sample_idx];
-            sc->sum += label;
+            sc->sum += label * SAMPLE_WEIGHT(sc->weights, sample_idx);
         }
     }
     sc->count += node->n_samples;
 }
 
-static double tree_regression(ET_tree tree, float *vector,
-                              uint32_t curtail_min_size, double *labels) {
-    sum_count sc = {0, 0, labels};
-    tree_lookup(tree, vector, curtail_min_size,
-                (node_processor) regression_node_processor, &sc);
+static double end_node_regression(ET_base_node *node, double *labels,
+                                  uint32_t *weights) {
+    sum_count sc = {0, 0, labels, weights};
+
+    if (IS_SPLIT(node) && CAST_SPLIT(node)->summarized) {
+        return CAST_SPLIT(node)->label_sum / (double) node->n_samples;
+    }
+    end_node_leaves(node, (node_processor) regression_node_processor, &sc);
     return sc.sum / (double) sc.count;
 }
 
@@ -134,284 +349,523 @@ static double tree_regression(ET_tree tree, float *vector,
 typedef struct {
     ET_class_counter *class_counter;
     double *labels;
+    uint32_t *weights;
 } class_freq_labels;
 
+// classes of a summarized leaf or split node, or NULL
+static inline ET_class_counter *node_classes(ET_base_node *node) {
+    return IS_LEAF(node) ? CAST_LEAF(node)->classes :
+                           CAST_SPLIT(node)->classes;
+}
+
+// a leaf, or a node with aggregated classes
 static void class_freq_node_processor(ET_base_node *node,
                                       class_freq_labels *cfl) {
+    ET_class_counter *classes = node_classes(node);
     ET_leaf_node *ln = CAST_LEAF(node);
 
-    if (ln->constant) {
-        uint32_t first_sample_idx = kv_A(ln->indexes, 0);
-        double class = cfl->labels[first_sample_idx];
+    if (classes) {
+        for(size_t k = 0; k < kv_size(*classes); k++) {
+            class_counter_elm *ce = &kv_A(*classes, k);
+            ET_class_counter_incr_n(cfl->class_counter, ce->key, ce->count);
+        }
+    } else if (ln->constant) {
+        double class = ln->summarized ? ln->label :
+                                        cfl->labels[kv_A(ln->indexes, 0)];
         ET_class_counter_incr_n(cfl->class_counter, class, node->n_samples);
     } else {
         for(size_t i=0; i < kv_size(ln->indexes); i++) {
             uint32_t sample_idx = kv_A(ln->indexes, i);
             double class = cfl->labels[sample_idx];
-            ET_class_counter_incr(cfl->class_counter, class);
+            ET_class_counter_incr_n(cfl->class_counter, class,
+                                    SAMPLE_WEIGHT(cfl->weights, sample_idx));
         }
     }
 }
 
-static ET_class_counter *tree_classification(ET_tree tree, float *vector,
-                                             uint32_t curtail_min_size,
-                                             double *labels) {
+// the aggregated classes of node, or those of the leaves below it
+static void end_node_classes(ET_base_node *node, class_freq_labels *cfl) {
+    if (node_classes(node)) {
+        class_freq_node_processor(node, cfl);
+    } else {
+        end_node_leaves(node, (node_processor) class_freq_node_processor,
+                        cfl);
+    }
+}
+
+static ET_class_counter *end_node_classification(ET_base_node *node,
+                                                 double *labels,
+                                                 uint32_t *weights) {
     ET_class_counter *cc = NULL;
     cc = ET_class_counter_new();
     check_mem(cc);
 
-    class_freq_labels cfl = {cc, labels};
-    tree_lookup(tree, vector, curtail_min_size,
-                (node_processor) class_freq_node_processor, &cfl);
+    class_freq_labels cfl = {cc, labels, weights};
+    end_node_classes(node, &cfl);
 
     exit:
     return cc;
 }
 
-// --- forest prediction ---
-
-
-uint_vec **ET_forest_neighbors_detail(ET_forest *forest, float *vector,
-                                         uint32_t curtail_min_size) {
-    uint32_t n_trees = kv_size(forest->trees);
-    uint_vec **neighbors_array = NULL;
+typedef struct {
+    ET_forest *forest;
+    int status;
+} summarize_data;
+
+// leaf aggregates are computed as a lookup ending in the leaf would, so
+// predictions ending in one leaf are unchanged. Constant leaves, most of
+// them when trees are grown fully, keep their label inline: only mixed
+// leaves get a class counter
+static void summarize_leaf(ET_base_node *node, summarize_data *sd) {
+    ET_forest *forest = sd->forest;
+    ET_leaf_node *ln = CAST_LEAF(node);
+    sum_count sc = {0, 0, forest->labels, forest->weights};
 
-    neighbors_array = malloc(sizeof(uint_vec *) * n_trees);
-    check_mem(neighbors_array);
+    if (! IS_LEAF(node) || ln->summarized) return;
+    regression_node_processor(node, &sc);
+    ln->label_sum = sc.sum;
+    if (ln->constant) {
+        ln->label = forest->labels[kv_A(ln->indexes, 0)];
+    } else if (! forest->params.regression) {
+        ln->classes = end_node_classification(node, forest->labels,
+                                              forest->weights);
+        if (ln->classes == NULL) {
+            sd->status = -1;
+            return;
+        }
+    }
+    ln->summarized = true;
+}
 
-    for(uint32_t i = 0; i < n_trees; i++) {
-        ET_tree t = kv_A(forest->trees, i);
-        neighbors_array[i] = tree_neighbors(t, vector, curtail_min_size);
+// split aggregates are those of a lookup ending in the split: the label sum
+// is folded leaf by leaf in lookup order, and the classes of the children
+// are merged higher first, which keeps their order of first occurrence
+static int summarize_split(ET_forest *forest, ET_base_node *node) {
+    ET_split_node *sn;
+    sum_count sc = {0, 0, forest->labels, forest->weights};
+    class_freq_labels cfl = {NULL, forest->labels, forest->weights};
+
+    if (IS_LEAF(node)) return 0;
+    sn = CAST_SPLIT(node);
+    check_mem(! summarize_split(forest, sn->higher_node));
+    check_mem(! summarize_split(forest, sn->lower_node));
+    if (sn->summarized) return 0;
+
+    end_node_leaves(node, (node_processor) regression_node_processor, &sc);
+    sn->label_sum = sc.sum;
+    if (! forest->params.regression) {
+        sn->classes = ET_class_counter_new();
+        check_mem(sn->classes);
+        cfl.class_counter = sn->classes;
+        end_node_classes(sn->higher_node, &cfl);
+        end_node_classes(sn->lower_node, &cfl);
     }
+    sn->summarized = true;
+    return 0;
 
     exit:
-    return neighbors_array;
+    return -1;
 }
 
+// lookups ending in the leaves of tree then read the aggregates instead of
+// the labels of their samples. Its split nodes are summarized as well if
+// those of the forest are
+int ET_tree_summarize(ET_forest *forest, ET_tree tree) {
+    summarize_data sd = {forest, 0};
+    tree_navigate(tree, (node_processor) summarize_leaf, &sd);
+    if (! sd.status && forest->splits_summarized) {
+        return summarize_split(forest, tree);
+    }
+    return sd.status;
+}
 
-double *ET_forest_neighbors(ET_forest *forest, float *vector,
-                            uint32_t curtail_min_size) {
-    uint_vec **neigh_detail;
-    size_t n_trees = kv_size(forest->trees);
-    double *nwa = NULL;
-
-    nwa = calloc(forest->n_samples, sizeof(double));
-    check_mem(nwa);
-
-    neigh_detail = ET_forest_neighbors_detail(forest, vector, curtail_min_size);
-    check_mem(neigh_detail);
-
-    for(size_t i = 0; i < n_trees; i++) {
-        uint_vec *tree_neighs = neigh_detail[i];
-        double incr = 1.0 / (double) (kv_size(*tree_neighs) * n_trees);
-
-        for(size_t j = 0; j < kv_size(*tree_neighs); j++) {
-            uint32_t sample_idx = kv_A(*tree_neighs, j);
-            nwa[sample_idx] += incr;
-        }
-        kv_destroy(*tree_neighs);
-        free(tree_neighs);
+// curtailed lookups then end in O(1) on split nodes too, at the cost of a
+// class counter per split node in classification forests. Trees loaded or
+// merged later are summarized by ET_tree_summarize
+int ET_forest_summarize_splits(ET_forest *forest) {
+    for(size_t i = 0; i < kv_size(forest->trees); i++) {
+        check_mem(! summarize_split(forest, kv_A(forest->trees, i)));
     }
-    free(neigh_detail);
+    forest->splits_summarized = true;
+    return 0;
 
     exit:
-    return nwa;
+    return -1;
 }
 
+// value of a tree whose lookup ends in leaf
+double leaf_regression(ET_forest *forest, ET_base_node *leaf) {
+    return end_node_regression(leaf, forest->labels, forest->weights);
+}
 
-double ET_forest_predict_class_majority(ET_forest *forest,
-                                        float *vector,
-                                        uint32_t curtail_min_size) {
-    double best_class = 0;
-    ET_class_counter tree_vote_counter;
-    ET_class_counter_init(tree_vote_counter);
-    SimpleRandomKISS2_t rand_state;
+ET_class_counter *leaf_classification(ET_forest *forest, ET_base_node *leaf) {
+    return end_node_classification(leaf, forest->labels, forest->weights);
+}
 
-    simplerandom_kiss2_seed(&rand_state, 0, 1, 2, 3);
+// --- partial aggregates ---
 
-    for(size_t i = 0; i < kv_size(forest->trees); i++) {
-        ET_class_counter *cc = NULL;
-        ET_tree tree = kv_A(forest->trees, i);
+// check that [b, e) of other directly precedes or follows [b, e) of partial
+#define PARTIAL_RANGES_ADJACENT(partial, other)                              \
+    ((partial)->tree_begin == (partial)->tree_end ||                         \
+     (other)->tree_begin == (other)->tree_end ||                             \
+     (partial)->tree_end == (other)->tree_begin ||                           \
+     (other)->tree_end == (partial)->tree_begin)
 
-        cc = tree_classification(tree, vector, curtail_min_size,
-                                 forest->labels);
-        check_mem(cc);
+#define PARTIAL_RANGES_MERGE(partial, other) do {                            \
+    if ((partial)->tree_begin == (partial)->tree_end) {                      \
+        (partial)->tree_begin = (other)->tree_begin;                         \
+        (partial)->tree_end = (other)->tree_end;                             \
+    } else if ((other)->tree_begin != (other)->tree_end) {                   \
+        if ((other)->tree_begin < (partial)->tree_begin)                     \
+            (partial)->tree_begin = (other)->tree_begin;                     \
+        if ((other)->tree_end > (partial)->tree_end)                         \
+            (partial)->tree_end = (other)->tree_end;                         \
+    }} while(0)
 
-        // compute class vote for tree
-        int32_t most_frequent_count = -1;
-        double_vec best_classes;
-        kv_init(best_classes);
 
-        log_debug(" --- tree count # %zu", i);
-        for(size_t k=0; k < kv_size(*cc); k++) {
-            class_counter_elm *ce = &(kv_A(*cc, k));
-            log_debug("class: %g count: %d", ce->key, ce->count);
-            if (most_frequent_count < (int32_t) ce->count) {
-                most_frequent_count = ce->count;
-                kv_clear(best_classes);
-                kv_push(double, best_classes, ce->key);
-            } else if (most_frequent_count == (int32_t) ce->count) {
-                kv_push(double, best_classes, ce->key);
-            }
-        }
-        ET_class_counter_destroy(*cc);
-        free(cc);
+// * regression
+
+// adds tree #tree_idx, whose lookup ended in node, to the partial. Trees
+// must be added in order
+static void regression_partial_add(ET_forest *forest, ET_base_node *node,
+                                   uint32_t tree_idx,
+                                   ET_regression_partial *partial) {
+    double y = end_node_regression(node, forest->labels, forest->weights);
+    UNUSED(tree_idx);
+    log_debug("tree #%d regression prediction = %g", tree_idx, y);
+    compensated_add(&partial->sum, &partial->compensation, y);
+}
 
-        // in case of tie, choose class randomly
-        uint32_t best_count = kv_size(best_classes);
-        uint32_t best_idx = best_count == 1 ? 0 : random_int(&rand_state,
-                                                             best_count);
-        double tree_best_class = kv_A(best_classes, best_idx);
+void ET_forest_partial_regression(ET_forest *forest, float *vector,
+                                  uint32_t curtail_min_size,
+                                  uint32_t tree_begin, uint32_t tree_end,
+                                  ET_regression_partial *partial) {
+    *partial = (ET_regression_partial) {tree_begin, tree_end, 0, 0};
 
-        ET_class_counter_incr(&tree_vote_counter, tree_best_class);
-        kv_destroy(best_classes);
+    for(uint32_t i = tree_begin; i < tree_end; i++) {
+        ET_base_node *node = tree_descend(kv_A(forest->trees, i), vector, 1,
+                                          curtail_min_size);
+        regression_partial_add(forest, node, i, partial);
     }
+}
 
-    // voting
-    int32_t best_count = -1;
+int ET_regression_partial_combine(ET_regression_partial *partial,
+                                  ET_regression_partial *other) {
+    check(PARTIAL_RANGES_ADJACENT(partial, other),
+          "partial tree ranges are not adjacent");
 
-    log_debug(" --- global count");
-    for(size_t i=0; i < kv_size(tree_vote_counter); i++) {
-        class_counter_elm *ce = &(kv_A(tree_vote_counter, i));
-        log_debug("class: %g count: %d", ce->key, ce->count);
-        if (best_count < (int32_t) ce->count) {
-            best_count = ce->count;
-            best_class = ce->key;
-        }
-    }
+    compensated_add(&partial->sum, &partial->compensation, other->sum);
+    partial->compensation += other->compensation;
+    PARTIAL_RANGES_MERGE(partial, other);
+    return 0;
 
     exit:
-    kv_destroy(tree_vote_counter);
-    return best_class;
+    return -1;
 }
 
+double ET_regression_partial_value(ET_regression_partial *partial) {
+    double n_trees = partial->tree_end - partial->tree_begin;
+    return (partial->sum + partial->compensation) / n_trees;
+}
 
-double ET_forest_predict_regression(ET_forest *forest,
-                                    float *vector,
-                                    uint32_t curtail_min_size) {
-    double y, sum = 0;
-    uint32_t n_trees = kv_size(forest->trees);
 
-    for(size_t i = 0; i < n_trees; i++) {
-        ET_tree tree = kv_A(forest->trees, i);
+// * classification
+
+void ET_class_partial_init(ET_class_partial *partial) {
+    partial->tree_begin = partial->tree_end = 0;
+    kv_init(partial->classes);
+    kv_init(partial->tie_trees);
+    kv_init(partial->tie_offsets);
+    kv_init(partial->tie_classes);
+}
+
+void ET_class_partial_destroy(ET_class_partial *partial) {
+    kv_destroy(partial->classes);
+    kv_destroy(partial->tie_trees);
+    kv_destroy(partial->tie_offsets);
+    kv_destroy(partial->tie_classes);
+}
+
+static ET_class_partial_elm *class_partial_get(ET_class_partial *partial,
+                                               double label) {
+    ET_class_partial_elm *elm;
 
-        y = tree_regression(tree, vector, curtail_min_size, forest->labels);
-        log_debug("tree #%zu regression prediction = %g", i, y);
-        sum += y;
+    for(size_t i = 0; i < kv_size(partial->classes); i++) {
+        elm = &kv_A(partial->classes, i);
+        if (elm->label == label) return elm;
     }
+    elm = (kv_pushp(ET_class_partial_elm, partial->classes));
+    *elm = (ET_class_partial_elm) {label, 0, UINT32_MAX, 0, 0};
+    return elm;
+}
 
-    return sum / (double) n_trees;
+static void class_partial_vote(ET_class_partial *partial, double label,
+                               uint32_t tree_idx) {
+    ET_class_partial_elm *elm = class_partial_get(partial, label);
+    elm->votes++;
+    if (tree_idx < elm->first_vote) elm->first_vote = tree_idx;
 }
 
+// empties the partial, for the tree range [tree_begin, tree_end)
+void class_partial_reset(ET_class_partial *partial,
+                         uint32_t tree_begin, uint32_t tree_end) {
+    partial->tree_begin = tree_begin;
+    partial->tree_end = tree_end;
+    kv_clear(partial->classes);
+    kv_clear(partial->tie_trees);
+    kv_clear(partial->tie_offsets);
+    kv_clear(partial->tie_classes);
+}
 
-typedef struct {
-    double value;
-    double weight;
-} value_weight;
-
-
-static int value_weight_compare(const void *a, const void *b) {
-    value_weight *aa = (value_weight *) a;
-    value_weight *bb = (value_weight *) b;
-    if (aa->value < bb->value) {
-        return -1;
-    } else if (aa->value == bb->value) {
-        return 0;
+// adds the class counts of tree #tree_idx to the partial. Trees must be
+// added in order
+void class_partial_count(ET_class_partial *partial, uint32_t tree_idx,
+                         ET_class_counter *cc) {
+    int32_t most_frequent_count = -1;
+    size_t n_best = 0;
+    double total = ET_class_counter_total(cc);
+
+    log_debug(" --- tree count # %d", tree_idx);
+    for(size_t k = 0; k < kv_size(*cc); k++) {
+        class_counter_elm *ce = &(kv_A(*cc, k));
+        ET_class_partial_elm *elm = class_partial_get(partial, ce->key);
+        log_debug("class: %g count: %d", ce->key, ce->count);
+        compensated_add(&elm->probability_sum, &elm->compensation,
+                        ce->count / total);
+        if (most_frequent_count < (int32_t) ce->count) {
+            most_frequent_count = ce->count;
+            n_best = 1;
+        } else if (most_frequent_count == (int32_t) ce->count) {
+            n_best++;
+        }
+    }
+
+    // ties are resolved randomly, in tree order, when finalizing
+    if (n_best == 1) {
+        for(size_t k = 0; k < kv_size(*cc); k++) {
+            class_counter_elm *ce = &(kv_A(*cc, k));
+            if ((int32_t) ce->count == most_frequent_count) {
+                class_partial_vote(partial, ce->key, tree_idx);
+            }
+        }
     } else {
-        return 1;
+        kv_push(uint32_t, partial->tie_trees, tree_idx);
+        kv_push(uint32_t, partial->tie_offsets,
+                          kv_size(partial->tie_classes));
+        for(size_t k = 0; k < kv_size(*cc); k++) {
+            class_counter_elm *ce = &(kv_A(*cc, k));
+            if ((int32_t) ce->count == most_frequent_count) {
+                kv_push(double, partial->tie_classes, ce->key);
+            }
+        }
     }
 }
 
+// a summarized node is counted as is, other end nodes through the scratch
+// counter
+static void class_partial_add(ET_forest *forest, ET_base_node *node,
+                              uint32_t tree_idx, ET_class_partial *partial,
+                              ET_class_counter *scratch) {
+    class_freq_labels cfl = {scratch, forest->labels, forest->weights};
 
-double ET_forest_predict_quantile(ET_forest *forest,
-                                  float *vector,
-                                  double quantile,
-                                  uint32_t curtail_min_size) {
-    double *nwa = NULL;
-    value_weight *vwa = NULL;
-    double ret = 0;
-
-    nwa = ET_forest_neighbors(forest, vector, curtail_min_size);
-    check_mem(nwa);
-    vwa = malloc(forest->n_samples * sizeof(value_weight));
-    check_mem(vwa);
+    if (node_classes(node)) {
+        class_partial_count(partial, tree_idx, node_classes(node));
+        return;
+    }
+    ET_class_counter_clear(*scratch);
+    end_node_leaves(node, (node_processor) class_freq_node_processor, &cfl);
+    class_partial_count(partial, tree_idx, scratch);
+}
 
-    for(size_t i = 0; i < forest->n_samples; i++) {
-        vwa[i].value = forest->labels[i];
-        vwa[i].weight = nwa[i];
+static void forest_partial_classification(ET_forest *forest, float *vector,
+                                          uint32_t curtail_min_size,
+                                          uint32_t tree_begin,
+                                          uint32_t tree_end,
+                                          ET_class_partial *partial,
+                                          ET_class_counter *scratch) {
+    class_partial_reset(partial, tree_begin, tree_end);
+
+    for(uint32_t i = tree_begin; i < tree_end; i++) {
+        ET_base_node *node = tree_descend(kv_A(forest->trees, i), vector, 1,
+                                          curtail_min_size);
+        class_partial_add(forest, node, i, partial, scratch);
     }
+}
+
+int ET_forest_partial_classification(ET_forest *forest, float *vector,
+                                     uint32_t curtail_min_size,
+                                     uint32_t tree_begin, uint32_t tree_end,
+                                     ET_class_partial *partial) {
+    ET_class_counter *scratch = NULL;
+
+    scratch = ET_class_counter_new();
+    check_mem(scratch);
+    forest_partial_classification(forest, vector, curtail_min_size,
+                                  tree_begin, tree_end, partial, scratch);
+
+    ET_class_counter_destroy(*scratch);
+    free(scratch);
+    return 0;
 
-    qsort(vwa, forest->n_samples, sizeof(value_weight), value_weight_compare);
+    exit:
+    return -1;
+}
 
-    double weight_accum = 0;
-    for(size_t i = 0; i < forest->n_samples - 1; i++) {
-        weight_accum += vwa[i].weight;
-        log_debug("weight: %g value: %g", weight_accum, vwa[i].value);
-        if (weight_accum == quantile) {
-            ret = (vwa[i].value + vwa[i+1].value) / 2;
-            goto exit;
-        } else if(weight_accum > quantile) {
-            ret = vwa[i].value;
-            goto exit;
+int ET_class_partial_combine(ET_class_partial *partial,
+                             ET_class_partial *other) {
+    ET_class_partial *first, *second;
+    uint_vec tie_trees, tie_offsets;
+    double_vec tie_classes;
+
+    check(PARTIAL_RANGES_ADJACENT(partial, other),
+          "partial tree ranges are not adjacent");
+
+    for(size_t i = 0; i < kv_size(other->classes); i++) {
+        ET_class_partial_elm *oelm = &kv_A(other->classes, i);
+        ET_class_partial_elm *elm = class_partial_get(partial, oelm->label);
+        elm->votes += oelm->votes;
+        if (oelm->first_vote < elm->first_vote) {
+            elm->first_vote = oelm->first_vote;
         }
+        compensated_add(&elm->probability_sum, &elm->compensation,
+                        oelm->probability_sum);
+        elm->compensation += oelm->compensation;
+    }
+
+    // ties must stay in tree order
+    first  = other->tree_begin < partial->tree_begin ? other : partial;
+    second = first == partial ? other : partial;
+
+    kv_init(tie_trees); kv_init(tie_offsets); kv_init(tie_classes);
+    kv_extend(uint32_t, tie_trees, first->tie_trees);
+    kv_extend(uint32_t, tie_trees, second->tie_trees);
+    kv_extend(uint32_t, tie_offsets, first->tie_offsets);
+    for(size_t i = 0; i < kv_size(second->tie_offsets); i++) {
+        uint32_t offset = kv_A(second->tie_offsets, i) +
+                          kv_size(first->tie_classes);
+        kv_push(uint32_t, tie_offsets, offset);
     }
+    kv_extend(double, tie_classes, first->tie_classes);
+    kv_extend(double, tie_classes, second->tie_classes);
+
+    kv_destroy(partial->tie_trees);
+    kv_destroy(partial->tie_offsets);
+    kv_destroy(partial->tie_classes);
+    partial->tie_trees = tie_trees;
+    partial->tie_offsets = tie_offsets;
+    partial->tie_classes = tie_classes;
 
-    ret = vwa[forest->n_samples - 1].value;
+    PARTIAL_RANGES_MERGE(partial, other);
+    return 0;
 
     exit:
-    if (nwa) free(nwa);
-    if (vwa) free(vwa);
-    return ret;
+    return -1;
 }
 
+// votes is scratch space for the final counts
+static double class_partial_majority(ET_class_partial *partial,
+                                     class_partial_elm_vec *votes_scratch) {
+    double best_class = 0;
+    int32_t best_count = -1;
+    uint32_t best_first_vote = UINT32_MAX;
+    size_t n_ties = kv_size(partial->tie_trees);
+    class_partial_elm_vec votes;
+    SimpleRandomKISS2_t rand_state;
 
-class_probability_vec *ET_forest_predict_probability(ET_forest *forest,
-                                                     float *vector,
-                                                     uint32_t curtail_min_size,
-                                                     bool smooth) {
-    bool error = true;
-    class_probability_vec *prob_vec = NULL;
-    double n_trees = kv_size(forest->trees);
-
-    prob_vec = malloc(sizeof(class_probability_vec));
-    check_mem(prob_vec);
-    kv_init(*prob_vec);
+    votes = *votes_scratch;
+    kv_copy(ET_class_partial_elm, votes, partial->classes);
+    simplerandom_kiss2_seed(&rand_state, 0, 1, 2, 3);
 
-    if (forest->class_frequency == NULL) {
-        compute_class_frequency(forest);
+    // in case of tie, choose class randomly
+    for(size_t i = 0; i < n_ties; i++) {
+        uint32_t tree_idx = kv_A(partial->tie_trees, i);
+        uint32_t begin = kv_A(partial->tie_offsets, i);
+        uint32_t end = (i + 1 < n_ties) ? kv_A(partial->tie_offsets, i + 1) :
+                                          kv_size(partial->tie_classes);
+        uint32_t best_idx = random_int(&rand_state, end - begin);
+        double label = kv_A(partial->tie_classes, begin + best_idx);
+
+        for(size_t k = 0; k < kv_size(votes); k++) {
+            ET_class_partial_elm *elm = &kv_A(votes, k);
+            if (elm->label == label) {
+                elm->votes++;
+                if (tree_idx < elm->first_vote) elm->first_vote = tree_idx;
+                break;
+            }
+        }
     }
 
-    for(size_t i = 0; i < kv_size(*forest->class_frequency); i++) {
-        double label = kv_A(*forest->class_frequency, i).key;
-        kv_push(class_probability, *prob_vec, ((class_probability) {label, 0}));
+    // voting. equal counts go to the class voted first
+    log_debug(" --- global count");
+    for(size_t i = 0; i < kv_size(votes); i++) {
+        ET_class_partial_elm *elm = &kv_A(votes, i);
+        if (elm->votes == 0) continue;
+        log_debug("class: %g count: %d", elm->label, elm->votes);
+        if (best_count < (int32_t) elm->votes ||
+            (best_count == (int32_t) elm->votes &&
+             elm->first_vote < best_first_vote)) {
+            best_count = elm->votes;
+            best_first_vote = elm->first_vote;
+            best_class = elm->label;
+        }
     }
 
-    for(size_t i = 0; i < n_trees; i++) {
-        ET_class_counter *cc = NULL;
-        ET_tree tree = kv_A(forest->trees, i);
+    *votes_scratch = votes;
+    return best_class;
+}
 
-        cc = tree_classification(tree, vector, curtail_min_size,
-                                 forest->labels);
-        check_mem(cc);
+double ET_class_partial_majority(ET_class_partial *partial) {
+    class_partial_elm_vec votes;
+    double best_class;
 
-        double total = ET_class_counter_total(cc);
+    kv_init(votes);
+    best_class = class_partial_majority(partial, &votes);
+    kv_destroy(votes);
+    return best_class;
+}
 
-        for(size_t k = 0; k < kv_size(*cc); k++) {
-            class_counter_elm *ce = &(kv_A(*cc, k));
-            for(size_t j = 0; j < kv_size(*prob_vec); j++) {
-                class_probability *cp = &kv_A(*prob_vec, j);
-                if (cp->label == ce->key) {
-                    cp->probability += ce->count / total / n_trees;
+// fills prob_vec with the probability of each class of the forest
+static void class_partial_probability(ET_forest *forest,
+                                      ET_class_partial *partial, bool smooth,
+                                      class_probability_vec *prob_vec) {
+    double n_trees = partial->tree_end - partial->tree_begin;
+
+    kv_clear(*prob_vec);
+    for(size_t i = 0; i < kv_size(*forest->class_frequency); i++) {
+        double label = kv_A(*forest->class_frequency, i).key;
+        double probability = 0;
+        for(size_t j = 0; j < kv_size(partial->classes); j++) {
+            ET_class_partial_elm *elm = &kv_A(partial->classes, j);
+            if (elm->label == label) {
+                probability = (elm->probability_sum + elm->compensation) /
+                              n_trees;
+                break;
+            }
+        }
+        kv_push(class_probability, *prob_vec,
+                ((class_probability) {label, probability}));
+    }
+
+    // undo the prior shift of class capped sampling
+    if (kv_size(forest->class_correction)) {
+        double total = 0;
+        for(size_t i = 0; i < kv_size(*prob_vec); i++) {
+            class_probability *cp = &kv_A(*prob_vec, i);
+            for(size_t k = 0; k < kv_size(forest->class_correction); k += 2) {
+                if (kv_A(forest->class_correction, k) == cp->label) {
+                    cp->probability *= kv_A(forest->class_correction, k + 1);
                     break;
                 }
             }
+            total += cp->probability;
+        }
+        for(size_t i = 0; total > 0 && i < kv_size(*prob_vec); i++) {
+            kv_A(*prob_vec, i).probability /= total;
         }
-        ET_class_counter_destroy(*cc);
-        free(cc);
     }
 
     if (smooth) {
-        double n_samples = forest->n_samples;
+        double n_samples = ET_class_counter_total(forest->class_frequency);
 
         for(size_t i = 0; i < kv_size(*prob_vec); i++) {
             double unsmoothed_prob, prior_prob;
@@ -423,47 +877,243 @@ class_probability_vec *ET_forest_predict_probability(ET_forest *forest,
                               (1 / n_samples) * prior_prob;
         }
     }
+}
 
-    error = false;
+class_probability_vec *ET_class_partial_probability(ET_forest *forest,
+                                                    ET_class_partial *partial,
+                                                    bool smooth) {
+    class_probability_vec *prob_vec = NULL;
+
+    prob_vec = malloc(sizeof(class_probability_vec));
+    check_mem(prob_vec);
+    kv_init(*prob_vec);
+    class_partial_probability(forest, partial, smooth, prob_vec);
+    return prob_vec;
 
     exit:
-    if (error && prob_vec != NULL) {
+    if (prob_vec != NULL) {
         kv_destroy(*prob_vec);
         free(prob_vec);
     }
-    return prob_vec;
+    return NULL;
 }
 
 
-double ET_forest_predict_class_bayes(ET_forest *forest, float *vector,
-                                     uint32_t curtail_min_size, bool smooth) {
-    double best_label = 0;
-    double best_probability = -1;
-    class_probability_vec *cpv = NULL;
+// --- forest prediction ---
 
-    cpv = ET_forest_predict_probability(forest, vector,
-                                        curtail_min_size, smooth);
-    check_mem(cpv);
 
-    for(size_t i = 0; i < kv_size(*cpv); i++) {
-        class_probability *cp = &kv_A(*cpv, i);
-        if (cp->probability > best_probability) {
-            best_probability = cp->probability;
-            best_label = cp->label;
-        }
+uint_vec **ET_forest_neighbors_detail(ET_forest *forest, float *vector,
+                                         uint32_t curtail_min_size) {
+    uint32_t n_trees = kv_size(forest->trees);
+    uint_vec **neighbors_array = NULL;
+
+    neighbors_array = malloc(sizeof(uint_vec *) * n_trees);
+    check_mem(neighbors_array);
+
+    for(uint32_t i = 0; i < n_trees; i++) {
+        ET_tree t = kv_A(forest->trees, i);
+        neighbors_array[i] = tree_neighbors(t, vector, curtail_min_size);
     }
 
     exit:
-    if (cpv != NULL) {
-        kv_destroy(*cpv);
-        free(cpv);
+    return neighbors_array;
+}
+
+
+// weight of the unit sample weight among the samples a tree reached, each
+// tree weighting 1 / n_trees
+static double tree_neighbors_increment(ET_forest *forest,
+                                       uint_vec *tree_neighs) {
+    size_t n_trees = kv_size(forest->trees);
+    double total_weight = 0;
+
+    for(size_t j = 0; j < kv_size(*tree_neighs); j++) {
+        uint32_t sample_idx = kv_A(*tree_neighs, j);
+        total_weight += SAMPLE_WEIGHT(forest->weights, sample_idx);
     }
-    return best_label;
+    return 1.0 / (total_weight * n_trees);
 }
 
+// adds the samples a tree reached. If touched, samples whose weight was 0
+// are appended to it
+static void add_tree_neighbors(ET_forest *forest, uint_vec *tree_neighs,
+                               double *nwa, uint_vec *touched) {
+    double incr = tree_neighbors_increment(forest, tree_neighs);
 
-double ET_forest_predict(ET_forest *forest, float *vector) {
-    if (forest->params.regression) {
+    for(size_t j = 0; j < kv_size(*tree_neighs); j++) {
+        uint32_t sample_idx = kv_A(*tree_neighs, j);
+        if (touched && nwa[sample_idx] == 0) {
+            kv_push(uint32_t, *touched, sample_idx);
+        }
+        nwa[sample_idx] += incr * SAMPLE_WEIGHT(forest->weights, sample_idx);
+    }
+}
+
+
+double *ET_forest_neighbors(ET_forest *forest, float *vector,
+                            uint32_t curtail_min_size) {
+    uint_vec **neigh_detail;
+    size_t n_trees = kv_size(forest->trees);
+    double *nwa = NULL;
+
+    nwa = calloc(forest->n_samples, sizeof(double));
+    check_mem(nwa);
+
+    neigh_detail = ET_forest_neighbors_detail(forest, vector, curtail_min_size);
+    check_mem(neigh_detail);
+
+    for(size_t i = 0; i < n_trees; i++) {
+        add_tree_neighbors(forest, neigh_detail[i], nwa, NULL);
+        kv_destroy(*neigh_detail[i]);
+        free(neigh_detail[i]);
+    }
+    free(neigh_detail);
+
+    exit:
+    return nwa;
+}
+
+
+double ET_forest_predict_class_majority(ET_forest *forest,
+                                        float *vector,
+                                        uint32_t curtail_min_size) {
+    double best_class = 0;
+    ET_predict_ctx ctx;
+
+    check_mem(! ET_predict_ctx_init(&ctx));
+    best_class = ET_forest_predict_class_majority_ctx(forest, vector,
+                                                      curtail_min_size, &ctx);
+    ET_predict_ctx_destroy(&ctx);
+
+    exit:
+    return best_class;
+}
+
+
+double ET_forest_predict_regression(ET_forest *forest,
+                                    float *vector,
+                                    uint32_t curtail_min_size) {
+    ET_regression_partial partial;
+
+    ET_forest_partial_regression(forest, vector, curtail_min_size,
+                                 0, kv_size(forest->trees), &partial);
+    return ET_regression_partial_value(&partial);
+}
+
+
+double ET_forest_predict_quantile(ET_forest *forest,
+                                  float *vector,
+                                  double quantile,
+                                  uint32_t curtail_min_size) {
+    double ret = 0;
+
+    ET_forest_predict_quantiles(forest, vector, &quantile, 1,
+                                curtail_min_size, &ret);
+    return ret;
+}
+
+
+int ET_forest_predict_quantiles(ET_forest *forest, float *vector,
+                                double *quantiles, uint32_t n_quantiles,
+                                uint32_t curtail_min_size, double *y) {
+    ET_predict_ctx ctx;
+
+    check_mem(! ET_predict_ctx_init(&ctx));
+    ET_forest_predict_quantiles_ctx(forest, vector, quantiles, n_quantiles,
+                                    curtail_min_size, &ctx, y);
+    ET_predict_ctx_destroy(&ctx);
+    return 0;
+
+    exit:
+    ET_predict_ctx_destroy(&ctx);
+    return -1;
+}
+
+
+class_probability_vec *ET_forest_predict_probability(ET_forest *forest,
+                                                     float *vector,
+                                                     uint32_t curtail_min_size,
+                                                     bool smooth) {
+    class_probability_vec *prob_vec = NULL, *ctx_prob_vec;
+    ET_predict_ctx ctx;
+
+    check_mem(! ET_predict_ctx_init(&ctx));
+    ctx_prob_vec = ET_forest_predict_probability_ctx(forest, vector,
+                                                     curtail_min_size, smooth,
+                                                     &ctx);
+    if (ctx_prob_vec) {
+        // the result is handed over from the context
+        prob_vec = malloc(sizeof(class_probability_vec));
+        if (prob_vec) {
+            *prob_vec = ctx.probabilities;
+            kv_init(ctx.probabilities);
+        }
+    }
+    ET_predict_ctx_destroy(&ctx);
+    check_mem(prob_vec);
+
+    exit:
+    return prob_vec;
+}
+
+
+neighbor_vec *ET_forest_neighbors_sparse(ET_forest *forest, float *vector,
+                                         uint32_t curtail_min_size,
+                                         uint32_t top_k) {
+    neighbor_vec *neighbors = NULL;
+    ET_predict_ctx ctx;
+
+    check_mem(! ET_predict_ctx_init(&ctx));
+    ET_forest_neighbors_sparse_ctx(forest, vector, curtail_min_size, top_k,
+                                   &ctx);
+    // the result is handed over from the context
+    neighbors = malloc(sizeof(neighbor_vec));
+    if (neighbors) {
+        *neighbors = ctx.sparse_neighbors;
+        kv_init(ctx.sparse_neighbors);
+    }
+    ET_predict_ctx_destroy(&ctx);
+    check_mem(neighbors);
+
+    exit:
+    return neighbors;
+}
+
+
+// most probable class, the first one in case of ties
+static double most_probable_class(class_probability_vec *cpv) {
+    double best_label = 0;
+    double best_probability = -1;
+
+    for(size_t i = 0; i < kv_size(*cpv); i++) {
+        class_probability *cp = &kv_A(*cpv, i);
+        if (cp->probability > best_probability) {
+            best_probability = cp->probability;
+            best_label = cp->label;
+        }
+    }
+    return best_label;
+}
+
+
+double ET_forest_predict_class_bayes(ET_forest *forest, float *vector,
+                                     uint32_t curtail_min_size, bool smooth) {
+    double best_label = 0;
+    ET_predict_ctx ctx;
+
+    check_mem(! ET_predict_ctx_init(&ctx));
+    best_label = ET_forest_predict_class_bayes_ctx(forest, vector,
+                                                   curtail_min_size, smooth,
+                                                   &ctx);
+    ET_predict_ctx_destroy(&ctx);
+
+    exit:
+    return best_label;
+}
+
+
+double ET_forest_predict(ET_forest *forest, float *vector) {
+    if (forest->params.regression) {
         return ET_forest_predict_regression(forest, vector, 1);
     } else {
         return ET_forest_predict_class_majority(forest, vector, 1);
@@ -471,6 +1121,962 @@ double ET_forest_predict(ET_forest *forest, float *vector) {
 }
 
 
+// --- prediction context ---
+// the _ctx functions do the work of the functions above in the buffers of
+// the context. Buffers only grow: once they fit the forest, predictions do
+// not allocate.
+
+int ET_predict_ctx_init(ET_predict_ctx *ctx) {
+    ET_class_partial_init(&ctx->partial);
+    kv_init(ctx->votes);
+    kv_init(ctx->probabilities);
+    kv_init(ctx->neighbors);
+    kv_init(ctx->neighbor_weights);
+    kv_init(ctx->touched);
+    kv_init(ctx->quantile_values);
+    kv_init(ctx->sparse_neighbors);
+    kv_init(ctx->neighbor_scratch);
+    kv_init(ctx->neighbor_slots);
+    ctx->counts = ET_class_counter_new();
+    check_mem(ctx->counts);
+    return 0;
+
+    exit:
+    return -1;
+}
+
+void ET_predict_ctx_destroy(ET_predict_ctx *ctx) {
+    ET_class_partial_destroy(&ctx->partial);
+    kv_destroy(ctx->votes);
+    kv_destroy(ctx->probabilities);
+    kv_destroy(ctx->neighbors);
+    kv_destroy(ctx->neighbor_weights);
+    kv_destroy(ctx->touched);
+    kv_destroy(ctx->quantile_values);
+    kv_destroy(ctx->sparse_neighbors);
+    kv_destroy(ctx->neighbor_scratch);
+    kv_destroy(ctx->neighbor_slots);
+    if (ctx->counts) {
+        ET_class_counter_destroy(*ctx->counts);
+        free(ctx->counts);
+    }
+}
+
+
+double ET_forest_predict_ctx(ET_forest *forest, float *vector,
+                             ET_predict_ctx *ctx) {
+    if (forest->params.regression) {
+        return ET_forest_predict_regression(forest, vector, 1);
+    } else {
+        return ET_forest_predict_class_majority_ctx(forest, vector, 1, ctx);
+    }
+}
+
+
+double ET_forest_predict_class_majority_ctx(ET_forest *forest, float *vector,
+                                            uint32_t curtail_min_size,
+                                            ET_predict_ctx *ctx) {
+    forest_partial_classification(forest, vector, curtail_min_size, 0,
+                                  kv_size(forest->trees), &ctx->partial,
+                                  ctx->counts);
+    return class_partial_majority(&ctx->partial, &ctx->votes);
+}
+
+
+class_probability_vec *ET_forest_predict_probability_ctx(ET_forest *forest,
+                                                 float *vector,
+                                                 uint32_t curtail_min_size,
+                                                 bool smooth,
+                                                 ET_predict_ctx *ctx) {
+    forest_partial_classification(forest, vector, curtail_min_size, 0,
+                                  kv_size(forest->trees), &ctx->partial,
+                                  ctx->counts);
+    class_partial_probability(forest, &ctx->partial, smooth,
+                              &ctx->probabilities);
+    return &ctx->probabilities;
+}
+
+
+double ET_forest_predict_class_bayes_ctx(ET_forest *forest, float *vector,
+                                         uint32_t curtail_min_size,
+                                         bool smooth, ET_predict_ctx *ctx) {
+    class_probability_vec *cpv = NULL;
+
+    cpv = ET_forest_predict_probability_ctx(forest, vector, curtail_min_size,
+                                            smooth, ctx);
+    check_mem(cpv);
+    return most_probable_class(cpv);
+
+    exit:
+    return 0;
+}
+
+
+// the weights of the previous call are reset through the touched samples,
+// not by clearing the whole array
+double *ET_forest_neighbors_ctx(ET_forest *forest, float *vector,
+                                uint32_t curtail_min_size,
+                                ET_predict_ctx *ctx) {
+    double *nwa;
+
+    for(size_t i = 0; i < kv_size(ctx->touched); i++) {
+        kv_A(ctx->neighbor_weights, kv_A(ctx->touched, i)) = 0;
+    }
+    kv_clear(ctx->touched);
+    while (kv_size(ctx->neighbor_weights) < forest->n_samples) {
+        kv_push(double, ctx->neighbor_weights, 0);
+    }
+    nwa = ctx->neighbor_weights.a;
+
+    for(size_t i = 0; i < kv_size(forest->trees); i++) {
+        kv_clear(ctx->neighbors);
+        tree_lookup(kv_A(forest->trees, i), vector, 1, curtail_min_size,
+                    (node_processor) append_neighbors, &ctx->neighbors);
+        add_tree_neighbors(forest, &ctx->neighbors, nwa, &ctx->touched);
+    }
+    return nwa;
+}
+
+
+double ET_forest_predict_quantile_ctx(ET_forest *forest, float *vector,
+                                      double quantile,
+                                      uint32_t curtail_min_size,
+                                      ET_predict_ctx *ctx) {
+    double ret;
+
+    ET_forest_predict_quantiles_ctx(forest, vector, &quantile, 1,
+                                    curtail_min_size, ctx, &ret);
+    return ret;
+}
+
+
+// * sparse neighbors
+// samples are accumulated in an open addressing hash of their index in
+// sparse_neighbors, in the order of ET_forest_neighbors, so their weights
+// are equal to its dense ones. The hash is empty between calls.
+
+static inline uint32_t neighbor_hash(uint32_t sample_idx) {
+    uint32_t h = sample_idx;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// slot of sample_idx, or the empty slot it would take: its sample index and
+// its index + 1 in sparse_neighbors, 0 if empty
+static uint32_t *neighbor_slot(ET_predict_ctx *ctx, uint32_t sample_idx) {
+    size_t mask = kv_size(ctx->neighbor_slots) / 2 - 1;
+    size_t i = neighbor_hash(sample_idx) & mask;
+    uint32_t *slot;
+
+    while ((slot = &kv_A(ctx->neighbor_slots, 2 * i))[1] &&
+           slot[0] != sample_idx) {
+        i = (i + 1) & mask;
+    }
+    return slot;
+}
+
+// doubles the slots, at least twice the samples
+static void neighbor_slots_grow(ET_predict_ctx *ctx) {
+    size_t n_slots = kv_size(ctx->neighbor_slots) ?
+                     kv_size(ctx->neighbor_slots) : 64;
+
+    if (kv_max(ctx->neighbor_slots) < 2 * n_slots) {
+        kv_resize(uint32_t, ctx->neighbor_slots, 2 * n_slots);
+    }
+    kv_size(ctx->neighbor_slots) = 2 * n_slots;
+    memset(ctx->neighbor_slots.a, 0, 2 * n_slots * sizeof(uint32_t));
+    for(size_t i = 0; i < kv_size(ctx->sparse_neighbors); i++) {
+        uint32_t sample_idx = kv_A(ctx->sparse_neighbors, i).sample_idx;
+        uint32_t *slot = neighbor_slot(ctx, sample_idx);
+        slot[0] = sample_idx;
+        slot[1] = i + 1;
+    }
+}
+
+static void add_tree_neighbors_sparse(ET_forest *forest,
+                                      uint_vec *tree_neighs,
+                                      ET_predict_ctx *ctx) {
+    double incr = tree_neighbors_increment(forest, tree_neighs);
+
+    for(size_t j = 0; j < kv_size(*tree_neighs); j++) {
+        uint32_t sample_idx = kv_A(*tree_neighs, j);
+        uint32_t *slot;
+
+        if (4 * (kv_size(ctx->sparse_neighbors) + 1) >
+            kv_size(ctx->neighbor_slots)) {
+            neighbor_slots_grow(ctx);
+        }
+        slot = neighbor_slot(ctx, sample_idx);
+        if (slot[1] == 0) {
+            ET_neighbor neighbor = {sample_idx, 0};
+            kv_push(ET_neighbor, ctx->sparse_neighbors, neighbor);
+            slot[0] = sample_idx;
+            slot[1] = kv_size(ctx->sparse_neighbors);
+        }
+        kv_A(ctx->sparse_neighbors, slot[1] - 1).weight +=
+                                incr * SAMPLE_WEIGHT(forest->weights, sample_idx);
+    }
+}
+
+// equal weights are lighter for higher sample indexes
+static inline bool neighbor_lighter(ET_neighbor *a, ET_neighbor *b) {
+    return a->weight < b->weight ||
+           (a->weight == b->weight && a->sample_idx > b->sample_idx);
+}
+
+static void neighbor_sift_down(ET_neighbor *heap, size_t n, size_t i) {
+    while (true) {
+        size_t lightest = i, left = 2 * i + 1, right = left + 1;
+        ET_neighbor tmp;
+
+        if (left < n && neighbor_lighter(&heap[left], &heap[lightest])) {
+            lightest = left;
+        }
+        if (right < n && neighbor_lighter(&heap[right], &heap[lightest])) {
+            lightest = right;
+        }
+        if (lightest == i) return;
+        tmp = heap[i];
+        heap[i] = heap[lightest];
+        heap[lightest] = tmp;
+        i = lightest;
+    }
+}
+
+// keeps the top_k heaviest in place, through a min heap of them
+static void neighbors_top_k(neighbor_vec *neighbors, uint32_t top_k) {
+    ET_neighbor *heap = neighbors->a;
+
+    for(size_t i = top_k / 2; i-- > 0;) {
+        neighbor_sift_down(heap, top_k, i);
+    }
+    for(size_t i = top_k; i < kv_size(*neighbors); i++) {
+        if (neighbor_lighter(&heap[0], &heap[i])) {
+            heap[0] = heap[i];
+            neighbor_sift_down(heap, top_k, 0);
+        }
+    }
+    kv_size(*neighbors) = top_k;
+}
+
+#define NEIGHBOR_RADIX_BITS 11
+
+// by sample_idx, a sample index or a label rank: LSD radix sort, with as
+// many digits as the forest sample indexes need
+static void neighbors_sort(ET_forest *forest, ET_predict_ctx *ctx) {
+    size_t n = kv_size(ctx->sparse_neighbors);
+    size_t counts[1 << NEIGHBOR_RADIX_BITS];
+    uint32_t mask = (1 << NEIGHBOR_RADIX_BITS) - 1;
+
+    if (kv_max(ctx->neighbor_scratch) < n) {
+        kv_resize(ET_neighbor, ctx->neighbor_scratch, n);
+    }
+    for(uint32_t shift = 0; shift < 32 && (forest->n_samples - 1) >> shift;
+        shift += NEIGHBOR_RADIX_BITS) {
+        ET_neighbor *from = ctx->sparse_neighbors.a;
+        ET_neighbor *to = ctx->neighbor_scratch.a;
+        neighbor_vec swap;
+        size_t offset = 0;
+
+        memset(counts, 0, sizeof(counts));
+        for(size_t i = 0; i < n; i++) {
+            counts[(from[i].sample_idx >> shift) & mask]++;
+        }
+        for(uint32_t d = 0; d <= mask; d++) {
+            size_t count = counts[d];
+            counts[d] = offset;
+            offset += count;
+        }
+        for(size_t i = 0; i < n; i++) {
+            to[counts[(from[i].sample_idx >> shift) & mask]++] = from[i];
+        }
+
+        swap = ctx->sparse_neighbors;
+        ctx->sparse_neighbors = ctx->neighbor_scratch;
+        ctx->neighbor_scratch = swap;
+        kv_size(ctx->sparse_neighbors) = n;
+    }
+}
+
+// unsorted in ctx->sparse_neighbors. Feature fid of the vector is
+// vector[fid * stride]
+static void collect_neighbors(ET_forest *forest, float *vector, size_t stride,
+                              uint32_t curtail_min_size, ET_predict_ctx *ctx) {
+    neighbor_vec *neighbors = &ctx->sparse_neighbors;
+
+    kv_clear(*neighbors);
+    for(size_t i = 0; i < kv_size(forest->trees); i++) {
+        kv_clear(ctx->neighbors);
+        tree_lookup(kv_A(forest->trees, i), vector, stride, curtail_min_size,
+                    (node_processor) append_neighbors, &ctx->neighbors);
+        add_tree_neighbors_sparse(forest, &ctx->neighbors, ctx);
+    }
+    // emptied in reverse insertion order, the probe sequences of the
+    // samples left stay intact
+    for(size_t i = kv_size(*neighbors); i-- > 0;) {
+        neighbor_slot(ctx, kv_A(*neighbors, i).sample_idx)[1] = 0;
+    }
+}
+
+static neighbor_vec *forest_neighbors_sparse(ET_forest *forest, float *vector,
+                                             size_t stride,
+                                             uint32_t curtail_min_size,
+                                             uint32_t top_k,
+                                             ET_predict_ctx *ctx) {
+    neighbor_vec *neighbors = &ctx->sparse_neighbors;
+
+    collect_neighbors(forest, vector, stride, curtail_min_size, ctx);
+    if (top_k && kv_size(*neighbors) > top_k) {
+        neighbors_top_k(neighbors, top_k);
+    }
+    neighbors_sort(forest, ctx);
+    return neighbors;
+}
+
+neighbor_vec *ET_forest_neighbors_sparse_ctx(ET_forest *forest, float *vector,
+                                             uint32_t curtail_min_size,
+                                             uint32_t top_k,
+                                             ET_predict_ctx *ctx) {
+    return forest_neighbors_sparse(forest, vector, 1, curtail_min_size, top_k,
+                                   ctx);
+}
+
+
+// * quantiles
+// weighted labels as if all the samples were scanned in label_order
+// summing their neighbor weights: the first sample where the sum reaches
+// the quantile gives its label, or the mean of its label and the next one
+// if the sum equals the quantile. Only the neighbors are sorted, by rank.
+
+#define RANK_LABEL(forest, rank) ((forest)->labels[(forest)->label_order[rank]])
+
+// ranked neighbors with their cumulated weights
+static double ranked_quantile(ET_forest *forest, neighbor_vec *ranked,
+                              double *cumulated, double quantile) {
+    uint32_t last = forest->n_samples - 1;
+    uint32_t rank = 0;
+    double weight = 0;
+
+    if (quantile <= 0) {
+        // reached at the first sample, a neighbor or not
+        if (kv_size(*ranked) && kv_A(*ranked, 0).sample_idx == 0) {
+            weight = cumulated[0];
+        }
+    } else {
+        size_t lo = 0, hi = kv_size(*ranked);
+
+        // first cumulated weight reaching it, never for NaN
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (! (cumulated[mid] >= quantile)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == kv_size(*ranked)) return RANK_LABEL(forest, last);
+        rank = kv_A(*ranked, lo).sample_idx;
+        weight = cumulated[lo];
+    }
+
+    if (rank == last) return RANK_LABEL(forest, last);
+    if (weight == quantile) {
+        return (RANK_LABEL(forest, rank) + RANK_LABEL(forest, rank + 1)) / 2;
+    }
+    return RANK_LABEL(forest, rank);
+}
+
+static void forest_quantiles(ET_forest *forest, float *vector, size_t stride,
+                             double *quantiles, uint32_t n_quantiles,
+                             uint32_t curtail_min_size, ET_predict_ctx *ctx,
+                             double *y) {
+    neighbor_vec *ranked = &ctx->sparse_neighbors;
+    double weight = 0;
+
+    collect_neighbors(forest, vector, stride, curtail_min_size, ctx);
+    for(size_t j = 0; j < kv_size(*ranked); j++) {
+        kv_A(*ranked, j).sample_idx =
+                            forest->label_ranks[kv_A(*ranked, j).sample_idx];
+    }
+    neighbors_sort(forest, ctx);
+
+    kv_clear(ctx->quantile_values);
+    for(size_t j = 0; j < kv_size(*ranked); j++) {
+        weight += kv_A(*ranked, j).weight;
+        kv_push(double, ctx->quantile_values, weight);
+    }
+    for(uint32_t k = 0; k < n_quantiles; k++) {
+        y[k] = ranked_quantile(forest, ranked, ctx->quantile_values.a,
+                               quantiles[k]);
+    }
+}
+
+void ET_forest_predict_quantiles_ctx(ET_forest *forest, float *vector,
+                                     double *quantiles, uint32_t n_quantiles,
+                                     uint32_t curtail_min_size,
+                                     ET_predict_ctx *ctx, double *y) {
+    forest_quantiles(forest, vector, 1, quantiles, n_quantiles,
+                     curtail_min_size, ctx, y);
+}
+
+
+// --- batch prediction ---
+// trees are walked in the outer loop over blocks of rows: a tree stays in
+// cache while the rows of the block go through it. Each row adds the trees
+// in order, as the single vector functions do, so results are identical.
+// Threads take whole row blocks. With fewer blocks than threads, the trees
+// are split in ranges instead: threads look up the rows of a block in their
+// range, then the per tree results are added in tree order.
+
+#define BATCH_BLOCK_ROWS 256
+
+// row #row of the matrix, whose feature fid is at [fid * MATRIX_STRIDE]
+#define MATRIX_ROW(X, row)                                                   \
+    ((X)->data + ((X)->column_major ? (size_t) (row) :                       \
+                                      (size_t) (row) * (X)->n_columns))
+#define MATRIX_STRIDE(X) ((X)->column_major ? (size_t) (X)->n_rows : 1)
+
+typedef enum {
+    BATCH_REGRESSION,
+    BATCH_MAJORITY,
+    BATCH_BAYES,
+    BATCH_PROBABILITY
+} batch_output;
+
+typedef struct {
+    ET_forest *forest;
+    ET_matrix *X;
+    uint32_t curtail_min_size;
+    bool smooth;
+    batch_output output;
+    double *out;
+    int *status;                    // per task, 0 once completed
+    // tree ranges: lookups of the rows of the current block, row by row
+    uint32_t block_begin, block_rows, n_ranges;
+    double *tree_values;
+    ET_base_node **tree_ends;       // classification: counted in tree order
+    lanes_descend_function descend;
+    // forest prefixes: outputs once the rows have added prefix_trees[p]
+    uint32_t *prefix_trees, n_prefixes;
+} batch_data;
+
+typedef struct {
+    ET_regression_partial regression[BATCH_BLOCK_ROWS];
+    ET_class_partial classes[BATCH_BLOCK_ROWS];
+    ET_class_counter *counts;       // classes of a curtailed lookup
+    class_probability_vec probabilities;    // of the current row
+} batch_block;
+
+static void batch_block_destroy(batch_block *bb) {
+    for(uint32_t r = 0; r < BATCH_BLOCK_ROWS; r++) {
+        ET_class_partial_destroy(&bb->classes[r]);
+    }
+    kv_destroy(bb->probabilities);
+    if (bb->counts) {
+        ET_class_counter_destroy(*bb->counts);
+        free(bb->counts);
+    }
+    free(bb);
+}
+
+static batch_block *batch_block_new(void) {
+    batch_block *bb = malloc(sizeof(batch_block));
+    check_mem(bb);
+    for(uint32_t r = 0; r < BATCH_BLOCK_ROWS; r++) {
+        ET_class_partial_init(&bb->classes[r]);
+    }
+    kv_init(bb->probabilities);
+    bb->counts = ET_class_counter_new();
+    if (bb->counts == NULL) {
+        batch_block_destroy(bb);
+        return NULL;
+    }
+
+    exit:
+    return bb;
+}
+
+static void batch_block_reset(batch_data *bd, batch_block *bb, uint32_t n) {
+    uint32_t n_trees = kv_size(bd->forest->trees);
+    for(uint32_t r = 0; r < n; r++) {
+        bb->regression[r] = (ET_regression_partial) {0, n_trees, 0, 0};
+        class_partial_reset(&bb->classes[r], 0, n_trees);
+    }
+}
+
+// outputs of rows [begin, begin + n), from the partials of the block
+static void batch_block_output(batch_data *bd, batch_block *bb,
+                               uint32_t begin, uint32_t n) {
+    class_probability_vec *cpv = &bb->probabilities;
+
+    for(uint32_t r = 0; r < n; r++) {
+        if (bd->output == BATCH_REGRESSION) {
+            bd->out[begin + r] =
+                            ET_regression_partial_value(&bb->regression[r]);
+            continue;
+        } else if (bd->output == BATCH_MAJORITY) {
+            bd->out[begin + r] = ET_class_partial_majority(&bb->classes[r]);
+            continue;
+        }
+
+        class_partial_probability(bd->forest, &bb->classes[r], bd->smooth,
+                                  cpv);
+        if (bd->output == BATCH_BAYES) {
+            bd->out[begin + r] = most_probable_class(cpv);
+        } else {
+            for(size_t k = 0; k < kv_size(*cpv); k++) {
+                bd->out[(size_t) (begin + r) * kv_size(*cpv) + k] =
+                                                kv_A(*cpv, k).probability;
+            }
+        }
+    }
+}
+
+// outputs of rows [begin, begin + n) for the prefixes of n_trees trees,
+// once the partials of the block have added them
+static void batch_block_prefixes(batch_data *bd, batch_block *bb,
+                                 uint32_t begin, uint32_t n,
+                                 uint32_t n_trees) {
+    for(uint32_t p = 0; p < bd->n_prefixes; p++) {
+        if (bd->prefix_trees[p] != n_trees) continue;
+        for(uint32_t r = 0; r < n; r++) {
+            double *y = &bd->out[(size_t) (begin + r) * bd->n_prefixes + p];
+            if (bd->output == BATCH_REGRESSION) {
+                ET_regression_partial prefix = bb->regression[r];
+                prefix.tree_end = n_trees;
+                *y = ET_regression_partial_value(&prefix);
+            } else {
+                *y = ET_class_partial_majority(&bb->classes[r]);
+            }
+        }
+    }
+}
+
+// end nodes in tree #tree_idx of the rows [row, row + n_lanes), at most
+// LANES of the n_rows left
+static uint32_t batch_descend(batch_data *bd, uint32_t tree_idx, uint32_t row,
+                              uint32_t n_rows, ET_base_node **ends) {
+    float *rows[LANES];
+    uint32_t n_lanes = n_rows < LANES ? n_rows : LANES;
+
+    for(uint32_t l = 0; l < n_lanes; l++) {
+        rows[l] = MATRIX_ROW(bd->X, row + l);
+    }
+    bd->descend(kv_A(bd->forest->trees, tree_idx), rows,
+                MATRIX_STRIDE(bd->X), bd->curtail_min_size, n_lanes, ends);
+    return n_lanes;
+}
+
+// all the trees for the rows of block #block
+static void batch_rows_task(uint32_t block, batch_data *bd) {
+    ET_matrix *X = bd->X;
+    batch_block *bb = NULL;
+    uint32_t begin = block * BATCH_BLOCK_ROWS;
+    uint32_t n = X->n_rows - begin < BATCH_BLOCK_ROWS ?
+                 X->n_rows - begin : BATCH_BLOCK_ROWS;
+
+    bb = batch_block_new();
+    check_mem(bb);
+    batch_block_reset(bd, bb, n);
+
+    for(uint32_t t = 0; t < kv_size(bd->forest->trees); t++) {
+        for(uint32_t r = 0; r < n; r += LANES) {
+            ET_base_node *ends[LANES];
+            uint32_t n_lanes = batch_descend(bd, t, begin + r, n - r, ends);
+            for(uint32_t l = 0; l < n_lanes; l++) {
+                if (bd->output == BATCH_REGRESSION) {
+                    regression_partial_add(bd->forest, ends[l], t,
+                                           &bb->regression[r + l]);
+                } else {
+                    class_partial_add(bd->forest, ends[l], t,
+                                      &bb->classes[r + l], bb->counts);
+                }
+            }
+        }
+        if (bd->prefix_trees) batch_block_prefixes(bd, bb, begin, n, t + 1);
+    }
+    if (! bd->prefix_trees) batch_block_output(bd, bb, begin, n);
+    bd->status[block] = 0;
+
+    exit:
+    if (bb) batch_block_destroy(bb);
+}
+
+// the rows of the current block for the trees of range #range
+static void batch_trees_task(uint32_t range, batch_data *bd) {
+    ET_forest *forest = bd->forest;
+    uint32_t n_trees = kv_size(forest->trees);
+    uint32_t tree_begin = (uint64_t) n_trees * range / bd->n_ranges;
+    uint32_t tree_end = (uint64_t) n_trees * (range + 1) / bd->n_ranges;
+
+    for(uint32_t t = tree_begin; t < tree_end; t++) {
+        for(uint32_t r = 0; r < bd->block_rows; r += LANES) {
+            ET_base_node *ends[LANES];
+            uint32_t n_lanes = batch_descend(bd, t, bd->block_begin + r,
+                                             bd->block_rows - r, ends);
+            for(uint32_t l = 0; l < n_lanes; l++) {
+                size_t i = (size_t) (r + l) * n_trees + t;
+                if (bd->output == BATCH_REGRESSION) {
+                    bd->tree_values[i] = end_node_regression(ends[l],
+                                                             forest->labels,
+                                                             forest->weights);
+                } else {
+                    bd->tree_ends[i] = ends[l];
+                }
+            }
+        }
+    }
+    bd->status[range] = 0;
+}
+
+static int batch_by_trees(batch_data *bd, uint32_t n_threads) {
+    ET_matrix *X = bd->X;
+    uint32_t n_trees = kv_size(bd->forest->trees);
+    size_t n_lookups = (size_t) BATCH_BLOCK_ROWS * n_trees;
+    batch_block *bb = NULL;
+    int ret = -1;
+
+    bd->n_ranges = n_threads < n_trees ? n_threads : n_trees;
+    bd->status = malloc(bd->n_ranges * sizeof(int));
+    check_mem(bd->status);
+    if (bd->output == BATCH_REGRESSION) {
+        bd->tree_values = malloc(n_lookups * sizeof(double));
+        check_mem(bd->tree_values);
+    } else {
+        bd->tree_ends = malloc(n_lookups * sizeof(ET_base_node *));
+        check_mem(bd->tree_ends);
+    }
+    bb = batch_block_new();
+    check_mem(bb);
+
+    for(uint32_t begin = 0; begin < X->n_rows; begin += BATCH_BLOCK_ROWS) {
+        bd->block_begin = begin;
+        bd->block_rows = X->n_rows - begin < BATCH_BLOCK_ROWS ?
+                         X->n_rows - begin : BATCH_BLOCK_ROWS;
+        for(uint32_t i = 0; i < bd->n_ranges; i++) bd->status[i] = -1;
+
+        parallel_run(n_threads, bd->n_ranges,
+                     (parallel_task) batch_trees_task, bd);
+        for(uint32_t i = 0; i < bd->n_ranges; i++) {
+            check(! bd->status[i], "tree range #%d failed", i);
+        }
+
+        batch_block_reset(bd, bb, bd->block_rows);
+        for(uint32_t r = 0; r < bd->block_rows; r++) {
+            for(uint32_t t = 0; t < n_trees; t++) {
+                size_t i = (size_t) r * n_trees + t;
+                if (bd->output == BATCH_REGRESSION) {
+                    ET_regression_partial *rp = &bb->regression[r];
+                    compensated_add(&rp->sum, &rp->compensation,
+                                    bd->tree_values[i]);
+                } else {
+                    class_partial_add(bd->forest, bd->tree_ends[i], t,
+                                      &bb->classes[r], bb->counts);
+                }
+            }
+        }
+        batch_block_output(bd, bb, begin, bd->block_rows);
+    }
+    ret = 0;
+
+    exit:
+    if (bd->tree_ends) free(bd->tree_ends);
+    if (bd->tree_values) free(bd->tree_values);
+    if (bd->status) free(bd->status);
+    if (bb) batch_block_destroy(bb);
+    return ret;
+}
+
+// threads take whole row blocks
+static int batch_by_rows(batch_data *bd, uint32_t n_threads) {
+    uint32_t n_blocks = (bd->X->n_rows + BATCH_BLOCK_ROWS - 1) /
+                        BATCH_BLOCK_ROWS;
+    int ret = -1;
+
+    bd->status = malloc(n_blocks * sizeof(int));
+    check_mem(bd->status);
+    for(uint32_t i = 0; i < n_blocks; i++) bd->status[i] = -1;
+
+    parallel_run(n_threads, n_blocks, (parallel_task) batch_rows_task, bd);
+    for(uint32_t i = 0; i < n_blocks; i++) {
+        check(! bd->status[i], "row block #%d failed", i);
+    }
+    ret = 0;
+
+    exit:
+    if (bd->status) free(bd->status);
+    return ret;
+}
+
+static int batch_predict(ET_forest *forest, ET_matrix *X,
+                         uint32_t curtail_min_size, bool smooth,
+                         batch_output output, uint32_t n_threads,
+                         double *out) {
+    batch_data bd = {forest, X, curtail_min_size, smooth, output, out,
+                     NULL, 0, 0, 0, NULL, NULL, lanes_descend(true),
+                     NULL, 0};
+    uint32_t n_blocks = (X->n_rows + BATCH_BLOCK_ROWS - 1) / BATCH_BLOCK_ROWS;
+
+    check(X->n_columns >= forest->n_features,
+          "matrix has %d columns, forest has %d features", X->n_columns,
+          forest->n_features);
+    if (n_blocks == 0) return 0;
+
+    if (n_threads > 1 && n_blocks < n_threads &&
+        kv_size(forest->trees) > 1) {
+        return batch_by_trees(&bd, n_threads);
+    }
+    return batch_by_rows(&bd, n_threads);
+
+    exit:
+    return -1;
+}
+
+double_vec *ET_forest_classes(ET_forest *forest) {
+    double_vec *classes = NULL;
+
+    classes = malloc(sizeof(double_vec));
+    check_mem(classes);
+    kv_init(*classes);
+    for(size_t i = 0; i < kv_size(*forest->class_frequency); i++) {
+        kv_push(double, *classes, kv_A(*forest->class_frequency, i).key);
+    }
+
+    exit:
+    return classes;
+}
+
+int ET_forest_predict_regression_batch(ET_forest *forest, ET_matrix *X,
+                                       uint32_t curtail_min_size,
+                                       uint32_t n_threads, double *y) {
+    return batch_predict(forest, X, curtail_min_size, false,
+                         BATCH_REGRESSION, n_threads, y);
+}
+
+int ET_forest_predict_class_majority_batch(ET_forest *forest, ET_matrix *X,
+                                           uint32_t curtail_min_size,
+                                           uint32_t n_threads, double *y) {
+    return batch_predict(forest, X, curtail_min_size, false, BATCH_MAJORITY,
+                         n_threads, y);
+}
+
+int ET_forest_predict_class_bayes_batch(ET_forest *forest, ET_matrix *X,
+                                        uint32_t curtail_min_size,
+                                        bool smooth, uint32_t n_threads,
+                                        double *y) {
+    return batch_predict(forest, X, curtail_min_size, smooth, BATCH_BAYES,
+                         n_threads, y);
+}
+
+int ET_forest_predict_probability_batch(ET_forest *forest, ET_matrix *X,
+                                        uint32_t curtail_min_size,
+                                        bool smooth, uint32_t n_threads,
+                                        double *probabilities) {
+    return batch_predict(forest, X, curtail_min_size, smooth,
+                         BATCH_PROBABILITY, n_threads, probabilities);
+}
+
+// every prefix is output by the same walk of the trees, by row blocks
+int ET_forest_predict_prefixes_batch(ET_forest *forest, ET_matrix *X,
+                                     uint32_t *prefix_trees,
+                                     uint32_t n_prefixes,
+                                     uint32_t curtail_min_size,
+                                     uint32_t n_threads, double *y) {
+    batch_data bd = {forest, X, curtail_min_size, false,
+                     forest->params.regression ? BATCH_REGRESSION :
+                                                 BATCH_MAJORITY,
+                     y, NULL, 0, 0, 0, NULL, NULL, lanes_descend(true),
+                     prefix_trees, n_prefixes};
+
+    check(X->n_columns >= forest->n_features,
+          "matrix has %d columns, forest has %d features", X->n_columns,
+          forest->n_features);
+    for(uint32_t p = 0; p < n_prefixes; p++) {
+        check(prefix_trees[p] > 0 &&
+              prefix_trees[p] <= kv_size(forest->trees) &&
+              (p == 0 || prefix_trees[p - 1] <= prefix_trees[p]),
+              "invalid forest prefix #%d: %d trees", p, prefix_trees[p]);
+    }
+    if (X->n_rows == 0) return 0;
+    return batch_by_rows(&bd, n_threads);
+
+    exit:
+    return -1;
+}
+
+
+// * neighbors
+// threads take row blocks, each with a context, and the neighbors of the
+// blocks are then copied in row order
+
+typedef struct {
+    ET_forest *forest;
+    ET_matrix *X;
+    uint32_t curtail_min_size;
+    uint32_t top_k;
+    size_t *row_offsets;            // neighbors of row r at [r + 1]
+    neighbor_vec *blocks;
+    int *status;
+} neighbors_batch_data;
+
+static void neighbors_block_task(uint32_t block, neighbors_batch_data *nbd) {
+    ET_matrix *X = nbd->X;
+    neighbor_vec *block_neighbors = &nbd->blocks[block];
+    ET_predict_ctx ctx;
+    uint32_t begin = block * BATCH_BLOCK_ROWS;
+    uint32_t n = X->n_rows - begin < BATCH_BLOCK_ROWS ?
+                 X->n_rows - begin : BATCH_BLOCK_ROWS;
+
+    if (ET_predict_ctx_init(&ctx)) goto exit;
+    for(uint32_t r = begin; r < begin + n; r++) {
+        neighbor_vec *neighbors = forest_neighbors_sparse(nbd->forest,
+                                    MATRIX_ROW(X, r), MATRIX_STRIDE(X),
+                                    nbd->curtail_min_size, nbd->top_k, &ctx);
+        nbd->row_offsets[r + 1] = kv_size(*neighbors);
+        for(size_t j = 0; j < kv_size(*neighbors); j++) {
+            kv_push(ET_neighbor, *block_neighbors, kv_A(*neighbors, j));
+        }
+    }
+    nbd->status[block] = 0;
+
+    exit:
+    ET_predict_ctx_destroy(&ctx);
+}
+
+int ET_forest_neighbors_batch(ET_forest *forest, ET_matrix *X,
+                              uint32_t curtail_min_size, uint32_t top_k,
+                              uint32_t n_threads, ET_neighbors_csr *csr) {
+    neighbors_batch_data nbd = {forest, X, curtail_min_size, top_k, NULL,
+                                NULL, NULL};
+    uint32_t n_blocks = (X->n_rows + BATCH_BLOCK_ROWS - 1) / BATCH_BLOCK_ROWS;
+    size_t n_neighbors;
+    int ret = -1;
+
+    csr->n_rows = X->n_rows;
+    kv_init(csr->sample_idxs);
+    kv_init(csr->weights);
+    csr->row_offsets = calloc((size_t) X->n_rows + 1, sizeof(size_t));
+    check_mem(csr->row_offsets);
+    check(X->n_columns >= forest->n_features,
+          "matrix has %d columns, forest has %d features", X->n_columns,
+          forest->n_features);
+    if (n_blocks == 0) return 0;
+
+    nbd.row_offsets = csr->row_offsets;
+    nbd.blocks = calloc(n_blocks, sizeof(neighbor_vec));
+    check_mem(nbd.blocks);
+    nbd.status = malloc(n_blocks * sizeof(int));
+    check_mem(nbd.status);
+    for(uint32_t i = 0; i < n_blocks; i++) nbd.status[i] = -1;
+
+    parallel_run(n_threads, n_blocks, (parallel_task) neighbors_block_task,
+                 &nbd);
+    for(uint32_t i = 0; i < n_blocks; i++) {
+        check(! nbd.status[i], "row block #%d failed", i);
+    }
+
+    for(uint32_t r = 0; r < X->n_rows; r++) {
+        csr->row_offsets[r + 1] += csr->row_offsets[r];
+    }
+    n_neighbors = csr->row_offsets[X->n_rows];
+    kv_resize(uint32_t, csr->sample_idxs, n_neighbors);
+    kv_resize(double, csr->weights, n_neighbors);
+    for(uint32_t i = 0; i < n_blocks; i++) {
+        for(size_t j = 0; j < kv_size(nbd.blocks[i]); j++) {
+            kv_push(uint32_t, csr->sample_idxs,
+                    kv_A(nbd.blocks[i], j).sample_idx);
+            kv_push(double, csr->weights, kv_A(nbd.blocks[i], j).weight);
+        }
+    }
+    ret = 0;
+
+    exit:
+    if (nbd.blocks) {
+        for(uint32_t i = 0; i < n_blocks; i++) kv_destroy(nbd.blocks[i]);
+        free(nbd.blocks);
+    }
+    if (nbd.status) free(nbd.status);
+    if (ret) ET_neighbors_csr_destroy(csr);
+    return ret;
+}
+
+void ET_neighbors_csr_destroy(ET_neighbors_csr *csr) {
+    if (csr->row_offsets) free(csr->row_offsets);
+    csr->row_offsets = NULL;
+    kv_destroy(csr->sample_idxs);
+    kv_destroy(csr->weights);
+    kv_init(csr->sample_idxs);
+    kv_init(csr->weights);
+}
+
+
+// * quantiles
+
+typedef struct {
+    ET_forest *forest;
+    ET_matrix *X;
+    double *quantiles;
+    uint32_t n_quantiles;
+    uint32_t curtail_min_size;
+    double *y;
+    int *status;
+} quantiles_batch_data;
+
+static void quantiles_block_task(uint32_t block, quantiles_batch_data *qbd) {
+    ET_matrix *X = qbd->X;
+    ET_predict_ctx ctx;
+    uint32_t begin = block * BATCH_BLOCK_ROWS;
+    uint32_t n = X->n_rows - begin < BATCH_BLOCK_ROWS ?
+                 X->n_rows - begin : BATCH_BLOCK_ROWS;
+
+    if (ET_predict_ctx_init(&ctx)) goto exit;
+    for(uint32_t r = begin; r < begin + n; r++) {
+        forest_quantiles(qbd->forest, MATRIX_ROW(X, r), MATRIX_STRIDE(X),
+                         qbd->quantiles, qbd->n_quantiles,
+                         qbd->curtail_min_size, &ctx,
+                         qbd->y + (size_t) r * qbd->n_quantiles);
+    }
+    qbd->status[block] = 0;
+
+    exit:
+    ET_predict_ctx_destroy(&ctx);
+}
+
+int ET_forest_predict_quantiles_batch(ET_forest *forest, ET_matrix *X,
+                                      double *quantiles, uint32_t n_quantiles,
+                                      uint32_t curtail_min_size,
+                                      uint32_t n_threads, double *y) {
+    quantiles_batch_data qbd = {forest, X, quantiles, n_quantiles,
+                                curtail_min_size, y, NULL};
+    uint32_t n_blocks = (X->n_rows + BATCH_BLOCK_ROWS - 1) / BATCH_BLOCK_ROWS;
+    int ret = -1;
+
+    check(X->n_columns >= forest->n_features,
+          "matrix has %d columns, forest has %d features", X->n_columns,
+          forest->n_features);
+    if (n_blocks == 0) return 0;
+
+    qbd.status = malloc(n_blocks * sizeof(int));
+    check_mem(qbd.status);
+    for(uint32_t i = 0; i < n_blocks; i++) qbd.status[i] = -1;
+
+    parallel_run(n_threads, n_blocks, (parallel_task) quantiles_block_task,
+                 &qbd);
+    for(uint32_t i = 0; i < n_blocks; i++) {
+        check(! qbd.status[i], "row block #%d failed", i);
+    }
+    ret = 0;
+
+    exit:
+    if (qbd.status) free(qbd.status);
+    return ret;
+}
+
+
 // --- feature importance ---
 
 typedef struct {
@@ -0,0 +1,48 @@
+#ifndef ET_PREDICT_H
+#define ET_PREDICT_H
+
+#include <math.h>
+
+#include "extratrees.h"
+#include "counter.h"
+
+
+// Neumaier summation: keeps partial sums independent from tree sharding
+static inline void compensated_add(double *sum, double *compensation,
+                                   double value) {
+    double t = *sum + value;
+    if (fabs(*sum) >= fabs(value)) {
+        *compensation += (*sum - t) + value;
+    } else {
+        *compensation += (value - t) + *sum;
+    }
+    *sum = t;
+}
+
+
+// --- prediction steps shared by the engines ---
+
+// rows walked together by tree_descend_lanes
+#define LANES 8
+
+// end nodes of the rows [0, n_lanes <= LANES) of a matrix, as tree_descend
+typedef void (*lanes_descend_function)(ET_tree tree, float **rows,
+                                       size_t stride,
+                                       uint32_t curtail_min_size,
+                                       uint32_t n_lanes, ET_base_node **ends);
+
+int compute_class_frequency(ET_forest *forest);
+int compute_label_order(ET_forest *forest);
+ET_base_node *tree_descend(ET_tree tree, float *vector, size_t stride,
+                           uint32_t curtail_min_size);
+// the AVX2 walk if allowed, supported by the CPU and ET_NO_AVX2 is unset,
+// the scalar one if not
+lanes_descend_function lanes_descend(bool allow_avx2);
+double leaf_regression(ET_forest *forest, ET_base_node *leaf);
+ET_class_counter *leaf_classification(ET_forest *forest, ET_base_node *leaf);
+void class_partial_reset(ET_class_partial *partial, uint32_t tree_begin,
+                         uint32_t tree_end);
+void class_partial_count(ET_class_partial *partial, uint32_t tree_idx,
+                         ET_class_counter *cc);
+
+#endif
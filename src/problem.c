@@ -1,15 +1,20 @@
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "extratrees.h"
 #include "problem.h"
+#include "parallel.h"
+#include "log.h"
 
 
 void ET_problem_print(ET_problem *prob, FILE *fout) {
     fprintf(fout, "problem: samples=%d features=%d\n", prob->n_samples,
                                                        prob->n_features);
     for(uint32_t s = 0; s < prob->n_samples; s++) {
-        fprintf(fout, "sample %d. label=%g features=", s, prob->labels[s]);
+        fprintf(fout, "sample %d. label=%g ", s, prob->labels[s]);
+        if (prob->weights) fprintf(fout, "weight=%d ", prob->weights[s]);
+        fprintf(fout, "features=");
         for(uint32_t fid = 0; fid < prob->n_features; fid++) {
             if (fid) fprintf(fout, " ");
             fprintf(fout, "%g", PROB_GET(prob, s, fid));
@@ -21,4 +26,234 @@ void ET_problem_print(ET_problem *prob, FILE *fout) {
 void ET_problem_destroy(ET_problem *prob) {
     if (prob->labels)  free(prob->labels);
     if (prob->vectors) free(prob->vectors);
+    if (prob->weights) free(prob->weights);
+}
+
+void ET_problem_view_init(ET_problem_view *view, ET_problem *prob) {
+    view->prob = prob;
+    view->sample_idxs = NULL;
+    view->n_samples = prob->n_samples;
+    view->feature_idxs = NULL;
+    view->n_features = prob->n_features;
+}
+
+
+// --- duplicate collapsing ---
+
+static size_t feature_size(ET_problem *prob) {
+    return prob->feature_type == ET_FLOAT64 ? sizeof(double) :
+           prob->feature_type == ET_UINT8   ? sizeof(uint8_t) :
+                                              sizeof(float);
+}
+
+#define FEATURE_PTR(prob, size, sample, fid)                                 \
+    ((unsigned char *) (prob)->vectors +                                     \
+     ((size_t) (fid) * (prob)->n_samples + (sample)) * (size))
+
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME  1099511628211ULL
+
+// FNV-1a over the bytes of the label and of the features of a sample
+static uint64_t sample_hash(ET_problem *prob, size_t size, uint32_t sample) {
+    uint64_t hash = FNV_OFFSET;
+    unsigned char *p = (unsigned char *) &prob->labels[sample];
+
+    for(size_t i = 0; i < sizeof(double); i++) {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    for(uint32_t fid = 0; fid < prob->n_features; fid++) {
+        p = FEATURE_PTR(prob, size, sample, fid);
+        for(size_t i = 0; i < size; i++) {
+            hash = (hash ^ p[i]) * FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+static bool samples_equal(ET_problem *prob, size_t size, uint32_t a,
+                          uint32_t b) {
+    if (memcmp(&prob->labels[a], &prob->labels[b], sizeof(double))) {
+        return false;
+    }
+    for(uint32_t fid = 0; fid < prob->n_features; fid++) {
+        if (memcmp(FEATURE_PTR(prob, size, a, fid),
+                   FEATURE_PTR(prob, size, b, fid), size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// new problem with one sample per distinct (vector, label) pair, weighted
+// by its number of occurrences. Samples keep their first occurrence order.
+ET_problem *ET_problem_collapse(ET_problem *prob) {
+    ET_problem *collapsed = NULL;
+    size_t size = feature_size(prob);
+    size_t table_size = 1;
+    uint32_t *table = NULL, *unique_idxs = NULL, *weights = NULL;
+    uint32_t n_unique = 0;
+    bool error = true;
+
+    check(prob->n_samples > 0, "cannot collapse an empty problem");
+    while (table_size < 2 * (size_t) prob->n_samples) table_size <<= 1;
+
+    // open addressing, linear probing. Slots hold unique index + 1
+    table = calloc(table_size, sizeof(uint32_t));
+    check_mem(table);
+    unique_idxs = malloc(prob->n_samples * sizeof(uint32_t));
+    check_mem(unique_idxs);
+    weights = malloc(prob->n_samples * sizeof(uint32_t));
+    check_mem(weights);
+
+    for(uint32_t s = 0; s < prob->n_samples; s++) {
+        size_t slot = sample_hash(prob, size, s) & (table_size - 1);
+        while (table[slot] &&
+               ! samples_equal(prob, size, unique_idxs[table[slot] - 1], s)) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot]) {
+            weights[table[slot] - 1] += SAMPLE_WEIGHT(prob->weights, s);
+        } else {
+            unique_idxs[n_unique] = s;
+            weights[n_unique] = SAMPLE_WEIGHT(prob->weights, s);
+            table[slot] = ++n_unique;
+        }
+    }
+    log_debug("collapsed %d samples into %d", prob->n_samples, n_unique);
+
+    collapsed = calloc(1, sizeof(ET_problem));
+    check_mem(collapsed);
+    collapsed->n_samples = n_unique;
+    collapsed->n_features = prob->n_features;
+    collapsed->feature_type = prob->feature_type;
+    collapsed->weights = realloc(weights, n_unique * sizeof(uint32_t));
+    check_mem(collapsed->weights);
+    weights = NULL;
+    collapsed->labels = malloc(n_unique * sizeof(double));
+    check_mem(collapsed->labels);
+    collapsed->vectors = malloc((size_t) n_unique * prob->n_features * size);
+    check_mem(collapsed->vectors);
+
+    for(uint32_t u = 0; u < n_unique; u++) {
+        collapsed->labels[u] = prob->labels[unique_idxs[u]];
+        for(uint32_t fid = 0; fid < prob->n_features; fid++) {
+            memcpy(FEATURE_PTR(collapsed, size, u, fid),
+                   FEATURE_PTR(prob, size, unique_idxs[u], fid), size);
+        }
+    }
+    error = false;
+
+    exit:
+    if (table) free(table);
+    if (unique_idxs) free(unique_idxs);
+    if (weights) free(weights);
+    if (error && collapsed) {
+        ET_problem_destroy(collapsed);
+        free(collapsed);
+        collapsed = NULL;
+    }
+    return collapsed;
+}
+
+
+// --- uninformative features ---
+
+typedef struct {
+    ET_problem *prob;
+    size_t size;
+    bool *constant;
+    uint64_t *hashes;
+} column_scan;
+
+// FNV-1a over the bytes of a column; constant if every element has the
+// bytes of the previous one
+static void scan_column(uint32_t fid, column_scan *cs) {
+    unsigned char *column = FEATURE_PTR(cs->prob, cs->size, 0, fid);
+    size_t n_bytes = (size_t) cs->prob->n_samples * cs->size;
+    uint64_t hash = FNV_OFFSET;
+    bool constant = true;
+
+    for(size_t i = 0; i < n_bytes; i++) {
+        hash = (hash ^ column[i]) * FNV_PRIME;
+        if (i >= cs->size && column[i] != column[i - cs->size]) {
+            constant = false;
+        }
+    }
+    cs->hashes[fid] = hash;
+    cs->constant[fid] = constant;
+}
+
+// view of all the samples and of the features that are neither constant
+// nor an exact copy of a previous feature. Splits on the dropped features
+// can never separate samples better than on the kept ones, and the view
+// keeps the original feature ids. Columns are scanned by n_threads.
+int ET_problem_view_init_informative(ET_problem_view *view,
+                                     ET_problem *prob, uint32_t n_threads) {
+    column_scan cs = {prob, feature_size(prob), NULL, NULL};
+    size_t table_size = 1;
+    uint32_t *table = NULL, *feature_idxs = NULL;
+    uint32_t n_kept = 0, n_constant = 0, n_duplicate = 0;
+    int ret = -1;
+
+    ET_problem_view_init(view, prob);
+    check(prob->n_features > 0 && prob->n_samples > 0, "empty problem");
+
+    cs.constant = malloc(prob->n_features * sizeof(bool));
+    check_mem(cs.constant);
+    cs.hashes = malloc(prob->n_features * sizeof(uint64_t));
+    check_mem(cs.hashes);
+    parallel_run(n_threads, prob->n_features, (parallel_task) scan_column,
+                 &cs);
+
+    // open addressing, linear probing. Slots hold kept index + 1
+    while (table_size < 2 * (size_t) prob->n_features) table_size <<= 1;
+    table = calloc(table_size, sizeof(uint32_t));
+    check_mem(table);
+    feature_idxs = malloc(prob->n_features * sizeof(uint32_t));
+    check_mem(feature_idxs);
+
+    for(uint32_t fid = 0; fid < prob->n_features; fid++) {
+        size_t slot = cs.hashes[fid] & (table_size - 1);
+        if (cs.constant[fid]) {
+            n_constant++;
+            continue;
+        }
+        while (table[slot] &&
+               (cs.hashes[feature_idxs[table[slot] - 1]] != cs.hashes[fid] ||
+                memcmp(FEATURE_PTR(prob, cs.size, 0,
+                                   feature_idxs[table[slot] - 1]),
+                       FEATURE_PTR(prob, cs.size, 0, fid),
+                       (size_t) prob->n_samples * cs.size))) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot]) {
+            n_duplicate++;
+        } else {
+            feature_idxs[n_kept] = fid;
+            table[slot] = ++n_kept;
+        }
+    }
+    // a problem without informative features still trains, to leaves
+    if (n_kept == 0) feature_idxs[n_kept++] = 0;
+    log_debug("dropped %d constant and %d duplicate features", n_constant,
+              n_duplicate);
+
+    view->feature_idxs = feature_idxs;
+    view->n_features = n_kept;
+    feature_idxs = NULL;
+    ret = 0;
+
+    exit:
+    if (cs.constant) free(cs.constant);
+    if (cs.hashes) free(cs.hashes);
+    if (table) free(table);
+    if (feature_idxs) free(feature_idxs);
+    return ret;
+}
+
+// frees the indexes of a view made by ET_problem_view_init_informative
+void ET_problem_view_destroy(ET_problem_view *view) {
+    if (view->sample_idxs) free(view->sample_idxs);
+    if (view->feature_idxs) free(view->feature_idxs);
+    view->sample_idxs = view->feature_idxs = NULL;
 }
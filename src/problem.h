@@ -1,3 +1,17 @@
 #include "kvec.h"
 
-#define PROB_GET(prob, sample, fid) prob->vectors[fid*prob->n_samples + sample]
+#define PROB_GET_TYPED(prob, type, sample, fid)                             \
+    (((type *) (prob)->vectors)[(size_t) (fid) * (prob)->n_samples + (sample)])
+
+#define PROB_GET(prob, sample, fid)                                          \
+    ((prob)->feature_type == ET_FLOAT64 ?                                    \
+        PROB_GET_TYPED(prob, double, sample, fid) :                          \
+     (prob)->feature_type == ET_UINT8 ?                                      \
+        PROB_GET_TYPED(prob, uint8_t, sample, fid) :                         \
+        PROB_GET_TYPED(prob, float, sample, fid))
+
+#define SAMPLE_WEIGHT(weights, sample) ((weights) ? (weights)[sample] : 1)
+
+#define VIEW_SAMPLE(view, i) ((view)->sample_idxs ? (view)->sample_idxs[i] : (i))
+#define VIEW_FEATURE(view, i) \
+    ((view)->feature_idxs ? (view)->feature_idxs[i] : (i))
@@ -0,0 +1,256 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "extratrees.h"
+#include "util.h"
+#include "log.h"
+#include "predict.h"
+
+
+// Leaves are numbered depth first, lower subtree first, so the exit leaf of
+// a tree is its leftmost leaf whose every ancestor condition holds. A split
+// sends x to its higher subtree iff !(x <= threshold), NaN included: that
+// is when the leaves of its lower subtree are cleared.
+
+#define QS_MAX_LEAVES 64
+
+typedef struct {
+    uint32_t feature_id;
+    float threshold;
+    uint32_t tree_idx;
+    uint64_t mask;
+} qs_condition;
+
+typedef struct {
+    ET_forest *forest;
+    uint32_t tree_idx;
+    uint32_t n_leaves;          // in the current tree
+    kvec_t(qs_condition) conditions;
+    double_vec leaf_values;
+    kvec_t(ET_class_counter *) leaf_classes;
+} qs_builder;
+
+
+static inline uint32_t lowest_bit(uint64_t bits) {
+#ifdef __GNUC__
+    return __builtin_ctzll(bits);
+#else
+    uint32_t i = 0;
+    while (! (bits & 1)) {
+        bits >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+static int condition_compare(const void *a, const void *b) {
+    const qs_condition *aa = a, *bb = b;
+    if (aa->feature_id != bb->feature_id) {
+        return aa->feature_id < bb->feature_id ? -1 : 1;
+    }
+    if (aa->threshold != bb->threshold) {
+        return aa->threshold < bb->threshold ? -1 : 1;
+    }
+    return (aa->tree_idx > bb->tree_idx) - (aa->tree_idx < bb->tree_idx);
+}
+
+static int qs_visit(ET_base_node *node, qs_builder *qb) {
+    if (IS_LEAF(node)) {
+        check(qb->n_leaves < QS_MAX_LEAVES,
+              "tree #%d has more than %d leaves", qb->tree_idx,
+              QS_MAX_LEAVES);
+        qb->n_leaves++;
+        if (qb->forest->params.regression) {
+            kv_push(double, qb->leaf_values,
+                    leaf_regression(qb->forest, node));
+        } else {
+            ET_class_counter *cc = leaf_classification(qb->forest, node);
+            check_mem(cc);
+            kv_push(ET_class_counter *, qb->leaf_classes, cc);
+        }
+    } else {
+        ET_split_node *sn = CAST_SPLIT(node);
+        uint32_t first_leaf = qb->n_leaves;
+        qs_condition condition;
+
+        check(! qs_visit(sn->lower_node, qb), "could not visit lower node");
+        condition.feature_id = sn->feature_id;
+        condition.threshold = sn->threshold;
+        condition.tree_idx = qb->tree_idx;
+        // clears the leaves [first_leaf, n_leaves) of the lower subtree,
+        // less than 64 as the higher one has at least a leaf
+        condition.mask = ~(((1ULL << (qb->n_leaves - first_leaf)) - 1)
+                           << first_leaf);
+        kv_push(qs_condition, qb->conditions, condition);
+        check(! qs_visit(sn->higher_node, qb), "could not visit higher node");
+    }
+    return 0;
+
+    exit:
+    return -1;
+}
+
+
+ET_quickscorer *ET_quickscorer_new(ET_forest *forest) {
+    ET_quickscorer *qs = NULL;
+    qs_builder qb = {forest, 0, 0, {0, 0, NULL}, {0, 0, NULL}, {0, 0, NULL}};
+    uint32_t n_trees = kv_size(forest->trees);
+    size_t n_conditions;
+    bool error = true;
+
+    qs = calloc(1, sizeof(ET_quickscorer));
+    check_mem(qs);
+    qs->forest = forest;
+    qs->leaf_offsets = malloc((n_trees + 1) * sizeof(uint32_t));
+    check_mem(qs->leaf_offsets);
+
+    for(uint32_t i = 0; i < n_trees; i++) {
+        qs->leaf_offsets[i] = kv_size(qb.leaf_values) +
+                              kv_size(qb.leaf_classes);
+        qb.tree_idx = i;
+        qb.n_leaves = 0;
+        check(! qs_visit(kv_A(forest->trees, i), &qb),
+              "tree #%d cannot be scored by bitvectors", i);
+    }
+    qs->leaf_offsets[n_trees] = kv_size(qb.leaf_values) +
+                                kv_size(qb.leaf_classes);
+    qs->leaf_values = qb.leaf_values.a;
+    qs->leaf_classes = qb.leaf_classes.a;
+    kv_init(qb.leaf_values);
+    kv_init(qb.leaf_classes);
+
+    n_conditions = kv_size(qb.conditions);
+    qsort(qb.conditions.a, n_conditions, sizeof(qs_condition),
+          condition_compare);
+    log_debug("%zu conditions, %d leaves", n_conditions,
+              qs->leaf_offsets[n_trees]);
+
+    qs->feature_offsets = calloc(forest->n_features + 1, sizeof(uint32_t));
+    check_mem(qs->feature_offsets);
+    qs->thresholds = malloc((n_conditions + 1) * sizeof(float));
+    check_mem(qs->thresholds);
+    qs->condition_trees = malloc((n_conditions + 1) * sizeof(uint32_t));
+    check_mem(qs->condition_trees);
+    qs->condition_masks = malloc((n_conditions + 1) * sizeof(uint64_t));
+    check_mem(qs->condition_masks);
+
+    for(size_t i = 0; i < n_conditions; i++) {
+        qs_condition *c = &kv_A(qb.conditions, i);
+        qs->thresholds[i] = c->threshold;
+        qs->condition_trees[i] = c->tree_idx;
+        qs->condition_masks[i] = c->mask;
+        qs->feature_offsets[c->feature_id + 1]++;
+    }
+    for(uint32_t fid = 0; fid < forest->n_features; fid++) {
+        qs->feature_offsets[fid + 1] += qs->feature_offsets[fid];
+    }
+    error = false;
+
+    exit:
+    kv_destroy(qb.conditions);
+    for(size_t i = 0; i < kv_size(qb.leaf_classes); i++) {
+        ET_class_counter_destroy(*kv_A(qb.leaf_classes, i));
+        free(kv_A(qb.leaf_classes, i));
+    }
+    kv_destroy(qb.leaf_classes);
+    kv_destroy(qb.leaf_values);
+    if (error && qs) {
+        ET_quickscorer_destroy(qs);
+        free(qs);
+        qs = NULL;
+    }
+    return qs;
+}
+
+
+void ET_quickscorer_destroy(ET_quickscorer *qs) {
+    uint32_t n_trees = kv_size(qs->forest->trees);
+
+    if (qs->leaf_classes) {
+        for(uint32_t i = 0; i < qs->leaf_offsets[n_trees]; i++) {
+            ET_class_counter_destroy(*qs->leaf_classes[i]);
+            free(qs->leaf_classes[i]);
+        }
+        free(qs->leaf_classes);
+    }
+    if (qs->leaf_values) free(qs->leaf_values);
+    if (qs->leaf_offsets) free(qs->leaf_offsets);
+    if (qs->feature_offsets) free(qs->feature_offsets);
+    if (qs->thresholds) free(qs->thresholds);
+    if (qs->condition_trees) free(qs->condition_trees);
+    if (qs->condition_masks) free(qs->condition_masks);
+}
+
+
+// feature fid of the vector is vector[fid * stride]. Trees are added in
+// order, as by ET_forest_predict, so results are identical
+static double qs_predict(ET_quickscorer *qs, float *vector, size_t stride,
+                         uint64_t *bitvectors, ET_class_partial *partial) {
+    ET_forest *forest = qs->forest;
+    uint32_t n_trees = kv_size(forest->trees);
+    ET_regression_partial rpartial = {0, n_trees, 0, 0};
+
+    for(uint32_t t = 0; t < n_trees; t++) bitvectors[t] = ~0ULL;
+
+    for(uint32_t fid = 0; fid < forest->n_features; fid++) {
+        float x = vector[fid * stride];
+        uint32_t end = qs->feature_offsets[fid + 1];
+        for(uint32_t i = qs->feature_offsets[fid];
+            i < end && ! (x <= qs->thresholds[i]); i++) {
+            bitvectors[qs->condition_trees[i]] &= qs->condition_masks[i];
+        }
+    }
+
+    if (forest->params.regression) {
+        for(uint32_t t = 0; t < n_trees; t++) {
+            uint32_t leaf = qs->leaf_offsets[t] + lowest_bit(bitvectors[t]);
+            compensated_add(&rpartial.sum, &rpartial.compensation,
+                            qs->leaf_values[leaf]);
+        }
+        return ET_regression_partial_value(&rpartial);
+    }
+
+    class_partial_reset(partial, 0, n_trees);
+    for(uint32_t t = 0; t < n_trees; t++) {
+        uint32_t leaf = qs->leaf_offsets[t] + lowest_bit(bitvectors[t]);
+        class_partial_count(partial, t, qs->leaf_classes[leaf]);
+    }
+    return ET_class_partial_majority(partial);
+}
+
+
+double ET_quickscorer_predict(ET_quickscorer *qs, float *vector) {
+    ET_matrix X = {vector, 1, qs->forest->n_features, false};
+    double y = NAN;
+    ET_quickscorer_predict_batch(qs, &X, &y);
+    return y;
+}
+
+
+int ET_quickscorer_predict_batch(ET_quickscorer *qs, ET_matrix *X,
+                                 double *y) {
+    uint64_t *bitvectors = NULL;
+    ET_class_partial partial;
+    size_t stride = X->column_major ? X->n_rows : 1;
+    int ret = -1;
+
+    ET_class_partial_init(&partial);
+    check(X->n_columns >= qs->forest->n_features,
+          "matrix has %d columns, forest has %d features", X->n_columns,
+          qs->forest->n_features);
+    bitvectors = malloc((kv_size(qs->forest->trees) + 1) * sizeof(uint64_t));
+    check_mem(bitvectors);
+
+    for(uint32_t r = 0; r < X->n_rows; r++) {
+        float *row = X->data + (X->column_major ? (size_t) r :
+                                                  (size_t) r * X->n_columns);
+        y[r] = qs_predict(qs, row, stride, bitvectors, &partial);
+    }
+    ret = 0;
+
+    exit:
+    if (bitvectors) free(bitvectors);
+    ET_class_partial_destroy(&partial);
+    return ret;
+}
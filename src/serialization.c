@@ -1,6 +1,7 @@
 #include "extratrees.h"
 #include "util.h"
 #include "log.h"
+#include "predict.h"
 
 
 // --- utils ---
@@ -103,18 +104,6 @@ static void load_uint_vec(uint_vec *uiv, unsigned char **bufferp) {
     }
 }
 
-static void dump_data(void *data, size_t n, uchar_vec *buffer) {
-    size_t buffer_size = kv_size(*buffer);
-    kv_resize(unsigned char, *buffer, buffer_size + n);
-    memcpy(&kv_A(*buffer, buffer_size), data, n);
-    kv_size(*buffer) = buffer_size + n;
-}
-
-static void load_data(void *data, size_t n, unsigned char **bufferp) {
-    memcpy(data, *bufferp, n);
-    *bufferp += n;
-}
-
 
 // --- dump / load node ---
 
@@ -155,6 +144,10 @@ static ET_base_node *node_load(unsigned char **bufferp) {
             ln->constant = (bool) load_char(bufferp);
             kv_init(ln->indexes);
             load_uint_vec(&ln->indexes, bufferp);
+            ln->summarized = false;
+            ln->label_sum = 0;
+            ln->label = 0;
+            ln->classes = NULL;
             node = (ET_base_node *) ln;
             break;
         }
@@ -166,6 +159,9 @@ static ET_base_node *node_load(unsigned char **bufferp) {
             sn->threshold = load_float(bufferp);
             sn->higher_node = NULL;
             sn->lower_node = NULL;
+            sn->summarized = false;
+            sn->label_sum = 0;
+            sn->classes = NULL;
             node = (ET_base_node *) sn;
             break;
         }
@@ -231,14 +227,81 @@ ET_tree ET_tree_load(unsigned char **bufferp) {
     return child_node;
 }
 
+// --- dump / load params ---
+// field by field, so that the dump does not depend on the struct layout
+
+static void params_dump(ET_params *params, uchar_vec *buffer) {
+    dump_uint32(params->number_of_features_tested, buffer);
+    dump_uint32(params->number_of_trees, buffer);
+    dump_char(params->regression, buffer);
+    dump_char(params->single_precision, buffer);
+    dump_char(params->mad_diversity, buffer);
+    dump_uint32(params->min_split_size, buffer);
+    dump_char(params->select_features_with_replacement, buffer);
+    dump_uint32(params->class_sample_cap, buffer);
+}
+
+static void params_load(ET_params *params, unsigned char **bufferp) {
+    params->number_of_features_tested = load_uint32(bufferp);
+    params->number_of_trees = load_uint32(bufferp);
+    params->regression = load_char(bufferp);
+    params->single_precision = load_char(bufferp);
+    params->mad_diversity = load_char(bufferp);
+    params->min_split_size = load_uint32(bufferp);
+    params->select_features_with_replacement = load_char(bufferp);
+    params->class_sample_cap = load_uint32(bufferp);
+}
+
+// dumps older than the forest header hold the struct of the first params,
+// padding included, as laid out by the compilers of the time
+static int legacy_params_load(ET_params *params, unsigned char **bufferp) {
+    struct {
+        uint32_t number_of_features_tested;
+        uint32_t number_of_trees;
+        unsigned char regression;           // bool
+        uint32_t min_split_size;
+        unsigned char select_features_with_replacement;
+    } legacy;
+
+    memcpy(&legacy, *bufferp, sizeof(legacy));
+    *bufferp += sizeof(legacy);
+    check(legacy.regression <= 1 &&
+          legacy.select_features_with_replacement <= 1,
+          "not a forest dump");
+
+    params->number_of_features_tested = legacy.number_of_features_tested;
+    params->number_of_trees = legacy.number_of_trees;
+    params->regression = legacy.regression;
+    params->single_precision = false;
+    params->mad_diversity = false;
+    params->min_split_size = legacy.min_split_size;
+    params->select_features_with_replacement =
+                                    legacy.select_features_with_replacement;
+    params->class_sample_cap = 0;
+    return 0;
+
+    exit:
+    return -1;
+}
+
+
 // --- dump / load forest ---
+// dumps start with a magic number and the format version: loading rejects
+// newer versions. Dumps without the magic are read as version 0
+// version 0: legacy params, labels and trees only
+// version 1: header, params field by field, weights and class corrections
+// version 2: splits_summarized flag after the class corrections
 
+#define FOREST_MAGIC 0x46535445     // "ETSF"
+#define FOREST_VERSION 2
 
 //FIXME handle endianess
 void ET_forest_dump(ET_forest *forest, uchar_vec *buffer, bool with_trees) {
     uint32_t size = (uint32_t) kv_size(forest->trees);
 
-    dump_data(&forest->params, sizeof(ET_params), buffer);
+    dump_uint32(FOREST_MAGIC, buffer);
+    dump_uint32(FOREST_VERSION, buffer);
+    params_dump(&forest->params, buffer);
     dump_double(forest->n_features, buffer);
     dump_double(forest->n_samples, buffer);
 
@@ -246,6 +309,19 @@ void ET_forest_dump(ET_forest *forest, uchar_vec *buffer, bool with_trees) {
         dump_double(forest->labels[i], buffer);
     }
 
+    dump_char(forest->weights != NULL, buffer);
+    if (forest->weights) {
+        for(uint32_t i = 0; i < forest->n_samples; i++) {
+            dump_uint32(forest->weights[i], buffer);
+        }
+    }
+
+    dump_uint32(kv_size(forest->class_correction), buffer);
+    for(size_t i = 0; i < kv_size(forest->class_correction); i++) {
+        dump_double(kv_A(forest->class_correction, i), buffer);
+    }
+    dump_char(forest->splits_summarized, buffer);
+
     if (with_trees) {
         dump_uint32(size, buffer);
 
@@ -258,34 +334,82 @@ void ET_forest_dump(ET_forest *forest, uchar_vec *buffer, bool with_trees) {
 }
 
 ET_forest *ET_forest_load(unsigned char **bufferp) {
-    uint32_t n_trees;
+    uint32_t magic, version, n_trees, n_corrections;
     ET_forest *forest = NULL;
+    bool error = true;
+
+    magic = load_uint32(bufferp);
+    if (magic == FOREST_MAGIC) {
+        version = load_uint32(bufferp);
+        check(version >= 1 && version <= FOREST_VERSION,
+              "unsupported forest dump version: %d", version);
+    } else {
+        // the first legacy params field
+        *bufferp -= 4;
+        version = 0;
+    }
 
     forest = malloc(sizeof(ET_forest));
     check_mem(forest);
     kv_init(forest->trees);
-
-    load_data(&forest->params, sizeof(ET_params), bufferp);
+    forest->labels = NULL;
+    forest->class_frequency = NULL;
+    forest->label_order = NULL;
+    forest->label_ranks = NULL;
+    forest->weights = NULL;
+    forest->splits_summarized = false;
+    kv_init(forest->class_correction);
+
+    if (version >= 1) {
+        params_load(&forest->params, bufferp);
+    } else {
+        check(! legacy_params_load(&forest->params, bufferp),
+              "could not load legacy params");
+    }
     forest->n_features = load_double(bufferp);
     forest->n_samples = load_double(bufferp);
 
     forest->labels = malloc(sizeof(double) * forest->n_samples);
     check_mem(forest->labels);
 
-    forest->class_frequency = NULL;
-
     for(size_t i = 0; i < forest->n_samples; i++) {
         forest->labels[i] = load_double(bufferp);
     }
+    check_mem(! compute_label_order(forest));
+
+    if (version >= 1 && load_char(bufferp)) {
+        forest->weights = malloc(sizeof(uint32_t) * forest->n_samples);
+        check_mem(forest->weights);
+        for(size_t i = 0; i < forest->n_samples; i++) {
+            forest->weights[i] = load_uint32(bufferp);
+        }
+    }
+    check_mem(! compute_class_frequency(forest));
+
+    n_corrections = version >= 1 ? load_uint32(bufferp) : 0;
+    for(uint32_t i = 0; i < n_corrections; i++) {
+        kv_push(double, forest->class_correction, load_double(bufferp));
+    }
+    // the aggregates are not dumped: loaded trees are summarized again
+    if (version >= 2) forest->splits_summarized = load_char(bufferp);
 
     kv_resize(ET_tree, forest->trees, forest->params.number_of_trees);
 
     n_trees = load_uint32(bufferp);
     for(uint32_t i = 0; i < n_trees; i++) {
-        kv_push(ET_tree, forest->trees, ET_tree_load(bufferp));
+        ET_tree tree = ET_tree_load(bufferp);
+        check_mem(tree);
+        kv_push(ET_tree, forest->trees, tree);
+        check_mem(! ET_tree_summarize(forest, tree));
     }
+    error = false;
 
     exit:
+    if (error && forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+        forest = NULL;
+    }
     return forest;
 
 }
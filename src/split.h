@@ -0,0 +1,342 @@
+// split search template: included by train.c once per diversity function,
+// it generates a split_problem_<suffix>_<weighting>_<feature type> for
+// every weighting (weighted, unweighted) and feature type, so that hot
+// loops have no indirect calls nor checks on the problem layout or on the
+// weights. Before inclusion define:
+//   SPLIT_SUFFIX     suffix of the generated functions
+//   SPLIT_DIVERSITY  diversity function of the task, with a _weighted and
+//                    an _unweighted instance
+//   SPLIT_SINGLE_PRECISION  1 to round thresholds to float when drawn
+
+#ifndef ET_SPLIT_H
+#define ET_SPLIT_H
+
+#define SPLIT_CONCAT_(name, suffix, weighting, ftype)                        \
+    name ## _ ## suffix ## _ ## weighting ## _ ## ftype
+#define SPLIT_CONCAT(name, suffix, weighting, ftype)                         \
+    SPLIT_CONCAT_(name, suffix, weighting, ftype)
+#define SPLIT_FN(name)                                                       \
+    SPLIT_CONCAT(name, SPLIT_SUFFIX, SPLIT_WEIGHTING, SPLIT_FEATURE_SUFFIX)
+
+#define SPLIT_INSTANCE_(name, weighting) name ## _ ## weighting
+#define SPLIT_INSTANCE(name, weighting) SPLIT_INSTANCE_(name, weighting)
+#define SPLIT_DIVERSITY_FN SPLIT_INSTANCE(SPLIT_DIVERSITY, SPLIT_WEIGHTING)
+
+// features are compared in single precision, as in prediction
+#define FEATURE_VALUE(prob, sample, fid)                                     \
+    ((float) PROB_GET_TYPED(prob, SPLIT_FEATURE_T, sample, fid))
+
+#endif
+
+
+#ifndef SPLIT_WEIGHTING
+
+#define SPLIT_WEIGHTING unweighted
+#include "split.h"
+#undef SPLIT_WEIGHTING
+
+#define SPLIT_WEIGHTING weighted
+#include "split.h"
+#undef SPLIT_WEIGHTING
+
+#undef SPLIT_SUFFIX
+#undef SPLIT_DIVERSITY
+#undef SPLIT_SINGLE_PRECISION
+
+#elif ! defined(SPLIT_FEATURE_T)
+
+#define SPLIT_FEATURE_T float
+#define SPLIT_FEATURE_SUFFIX float32
+#include "split.h"
+
+#define SPLIT_FEATURE_T double
+#define SPLIT_FEATURE_SUFFIX float64
+#include "split.h"
+
+#define SPLIT_FEATURE_T uint8_t
+#define SPLIT_FEATURE_SUFFIX uint8
+#include "split.h"
+
+#else
+
+
+static min_max SPLIT_FN(get_feature_min_max)(ET_problem *prob,
+                                              uint_vec *sample_idxs,
+                                              uint32_t fid) {
+
+    min_max mm = {DBL_MAX, -DBL_MAX};
+
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        float val = FEATURE_VALUE(prob, sample_idx, fid);
+        if (val > mm.max) mm.max = val;
+        if (val < mm.min) mm.min = val;
+    });
+
+    return mm;
+}
+
+
+static void SPLIT_FN(split_on_threshold)(ET_problem *prob,
+                                         uint32_t feature_idx,
+                                         double threshold,
+                                         uint_vec *sample_idxs,
+                                         uint_vec *higher_idxs,
+                                         uint_vec *lower_idxs) {
+
+    kv_clear(*higher_idxs);
+    kv_clear(*lower_idxs);
+
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        double val = FEATURE_VALUE(prob, sample_idx, feature_idx);
+        if (val <= threshold) {
+            log_debug("sample_idx: %d, val: %g -> lower", sample_idx, val);
+            kv_push(uint32_t, *lower_idxs, sample_idx);
+        } else {
+            log_debug("sample_idx: %d, val: %g -> higher", sample_idx, val);
+            kv_push(uint32_t, *higher_idxs, sample_idx);
+        }
+    });
+}
+
+
+// labels come from the diversity pass of the parent split.
+// A feature constant in the parent is constant in the node too:
+// constant_fids are moved to the tail of the deck and never drawn.
+static void SPLIT_FN(split_problem)(tree_builder *tb, uint_vec *sample_idxs,
+                                    node_labels *labels,
+                                    uint_vec *constant_fids,
+                                    builder_stack_node *stack_node) {
+
+    ET_base_node *node = NULL;
+    bool split_found = false;
+    double best_threshold = 0;       // initialized to silence compiler warn
+    uint32_t best_feature_idx = 0.0; // initialized to silence compiler warn
+    ET_problem *prob = tb->prob;
+
+    double higher_diversity, lower_diversity;
+    uint_vec lower_idxs, higher_idxs;
+    kv_init(lower_idxs); kv_init(higher_idxs);
+
+    log_debug(">>>>> split_problem. n samples: %zu", kv_size(*sample_idxs));
+
+    // check if min_split_size is reached
+    // NOTE: this does not guarantee that leaf size is always >= min_split_size
+    if(labels->weight < tb->params.min_split_size) {
+        log_debug("min_split_size (%d) NOT reached. sample size: %d",
+                                                    tb->params.min_split_size,
+                                                    labels->weight);
+        STATS_START(tb, t_alloc);
+        node = (ET_base_node *) new_leaf_node(sample_idxs, labels);
+        STATS_STOP(tb, alloc_time, t_alloc);
+        goto exit;
+    }
+
+    // if labels are constant return leaf node
+    if(labels->constant) {
+        log_debug("labels are constant. generating leaf node ...");
+        STATS_START(tb, t_alloc);
+        node = (ET_base_node *) new_leaf_node(sample_idxs, labels);
+        STATS_STOP(tb, alloc_time, t_alloc);
+        goto exit;
+    }
+
+    {
+        double best_diversity = DBL_MAX;
+        uint32_t n_features = tb->view.n_features;
+        uint32_t nb_features_tested = 0;
+        uint32_t nb_features_to_test = tb->params.number_of_features_tested;
+        bool with_replacement = tb->params.select_features_with_replacement;
+        uint32_t max_test;
+
+        for(size_t i = 0; i < kv_size(*constant_fids); i++) {
+            n_features--;
+            deck_swap(tb, tb->deck_pos[kv_A(*constant_fids, i)], n_features);
+        }
+        max_test = with_replacement ? 10 * n_features : n_features;
+
+        log_debug("number of features to test: %d", nb_features_to_test);
+        log_debug("constant features skipped: %zu", kv_size(*constant_fids));
+
+        // select best split
+        while (nb_features_to_test && nb_features_tested < max_test &&
+               n_features) {
+            min_max mm;
+            uint32_t feature_idx;
+            double threshold, diversity;
+            node_labels higher_labels, lower_labels = {false, 0};
+
+            log_debug("--- new loop cycle ---");
+
+            // select random feature
+            STATS_START(tb, t_random);
+            if (with_replacement) {
+                uint32_t deck_idx = random_int(&tb->rand_state, n_features);
+                feature_idx = tb->features_deck[deck_idx];
+            } else {
+                uint32_t deck_idx, end_idx;
+
+                deck_idx = random_int(&tb->rand_state,
+                                      n_features - nb_features_tested);
+                feature_idx = tb->features_deck[deck_idx];
+                end_idx = n_features - nb_features_tested - 1;
+                deck_swap(tb, deck_idx, end_idx);
+            }
+            nb_features_tested++;
+            STATS_STOP(tb, random_time, t_random);
+            log_debug("number of feature selected %s replacement: %d",
+                    with_replacement ? "WITH" : "WITHOUT", nb_features_tested);
+            log_debug("feature index: %d", feature_idx);
+
+            // select random threshold in (min, max)
+            STATS_START(tb, t_min_max);
+            mm = SPLIT_FN(get_feature_min_max)(prob, sample_idxs,
+                                                 feature_idx);
+            STATS_STOP(tb, min_max_time, t_min_max);
+            STATS_INCR(tb, n_samples_scanned, kv_size(*sample_idxs));
+            log_debug("values - min: %g max: %g", mm.min, mm.max);
+            if (mm.min == mm.max) {
+                log_debug("constant feature");
+                STATS_INCR(tb, n_constant_features, 1);
+                kv_push(uint32_t, stack_node->constant_fids, feature_idx);
+                if (with_replacement) {
+                    n_features--;
+                    deck_swap(tb, tb->deck_pos[feature_idx], n_features);
+                }
+                continue;
+            } else {
+                split_found = true;
+            }
+
+            STATS_START(tb, t_threshold);
+            double delta = mm.max - mm.min;
+            threshold = mm.min + random_double(&tb->rand_state) * delta;
+#if SPLIT_SINGLE_PRECISION
+            threshold = single_threshold(threshold, mm);
+#endif
+            STATS_STOP(tb, random_time, t_threshold);
+
+            log_debug("threshold: %g", threshold);
+
+            // evaluate split diversity
+            STATS_INCR(tb, n_candidate_splits, 1);
+            STATS_INCR(tb, n_samples_scanned, kv_size(*sample_idxs));
+            {
+                size_t m0_higher = kv_max(higher_idxs);
+                size_t m0_lower  = kv_max(lower_idxs);
+                STATS_START(tb, t_split);
+                SPLIT_FN(split_on_threshold)(prob, feature_idx, threshold,
+                                             sample_idxs, &higher_idxs,
+                                             &lower_idxs);
+                STATS_STOP(tb, split_time, t_split);
+                STATS_KV_GROWTH(tb, uint32_t, higher_idxs, m0_higher);
+                STATS_KV_GROWTH(tb, uint32_t, lower_idxs,  m0_lower);
+            }
+            // the lower side is skipped if the higher one is already worse
+            STATS_START(tb, t_diversity);
+            STATS_INCR(tb, n_samples_scanned, kv_size(higher_idxs));
+            higher_diversity = SPLIT_DIVERSITY_FN(tb, &higher_idxs, 0,
+                                                  best_diversity,
+                                                  &higher_labels);
+            lower_diversity = 0;
+            if (higher_diversity < best_diversity) {
+                STATS_INCR(tb, n_samples_scanned, kv_size(lower_idxs));
+                lower_diversity = SPLIT_DIVERSITY_FN(tb, &lower_idxs,
+                                                     higher_diversity,
+                                                     best_diversity,
+                                                     &lower_labels);
+            }
+            STATS_STOP(tb, diversity_time, t_diversity);
+
+            diversity = higher_diversity + lower_diversity;
+
+            if (diversity < best_diversity) {
+                log_debug("%s diversity: %g",
+                          tb->params.regression ? "regr" : "class", diversity);
+            } else {
+                log_debug("%s diversity bound reached: %g",
+                          tb->params.regression ? "regr" : "class",
+                          best_diversity);
+            }
+
+
+            if (diversity < best_diversity) {
+                size_t m0_higher = kv_max(stack_node->higher_idxs);
+                size_t m0_lower  = kv_max(stack_node->lower_idxs);
+                log_debug("diversity is new best");
+                best_threshold = threshold;
+                best_feature_idx = feature_idx;
+                best_diversity = diversity;
+                STATS_START(tb, t_alloc);
+                kv_copy(uint32_t, stack_node->higher_idxs, higher_idxs);
+                kv_copy(uint32_t, stack_node->lower_idxs,  lower_idxs);
+                STATS_STOP(tb, alloc_time, t_alloc);
+                STATS_KV_GROWTH(tb, uint32_t, stack_node->higher_idxs,
+                                              m0_higher);
+                STATS_KV_GROWTH(tb, uint32_t, stack_node->lower_idxs,
+                                              m0_lower);
+                stack_node->higher_diversity = higher_diversity;
+                stack_node->lower_diversity = lower_diversity;
+                stack_node->higher_labels = higher_labels;
+                stack_node->lower_labels = lower_labels;
+            }
+
+            if (diversity == 0) {
+                log_debug("diversity == 0");
+                break;
+            }
+
+            nb_features_to_test--;
+
+        }
+    }
+
+    if (split_found) {
+        // let's build a split node ...
+        log_debug("split found. feature_idx: %d, threshold: %g",                                                                best_feature_idx,
+                                                best_threshold);
+        ET_split_node *sn;
+
+        STATS_START(tb, t_alloc);
+        sn = malloc(sizeof(ET_split_node));
+        STATS_STOP(tb, alloc_time, t_alloc);
+        check_mem(sn);
+        sn->base.type = ET_SPLIT_NODE;
+        sn->base.n_samples = labels->weight;
+        sn->feature_id = best_feature_idx;
+        sn->threshold = best_threshold;
+        sn->lower_node = NULL;
+        sn->higher_node = NULL;
+        sn->summarized = false;
+        sn->label_sum = 0;
+        sn->classes = NULL;
+        node = (ET_base_node *) sn;
+        kv_extend(uint32_t, stack_node->constant_fids, *constant_fids);
+    } else {
+        log_debug("split NOT found. building leaf node ...");
+        STATS_START(tb, t_alloc);
+        node = (ET_base_node *) new_leaf_node(sample_idxs, labels);
+        STATS_STOP(tb, alloc_time, t_alloc);
+    }
+
+    exit:
+    kv_destroy(lower_idxs);
+    kv_destroy(higher_idxs);
+    stack_node->node = node;
+
+    if (tb->stats && node) {
+        tb->stats->n_nodes++;
+        if (IS_LEAF(node)) {
+            tb->stats->n_leaves++;
+            tb->stats->bytes_allocated += sizeof(ET_leaf_node) +
+                kv_max(CAST_LEAF(node)->indexes) * sizeof(uint32_t);
+        } else {
+            tb->stats->bytes_allocated += sizeof(ET_split_node);
+        }
+    }
+}
+
+
+#undef SPLIT_FEATURE_T
+#undef SPLIT_FEATURE_SUFFIX
+
+#endif
@@ -1,5 +1,8 @@
+#define _POSIX_C_SOURCE 199309L
+
 #include <float.h>
 #include <math.h>
+#include <time.h>
 
 #include "extratrees.h"
 #include "train.h"
@@ -7,6 +10,7 @@
 #include "problem.h"
 #include "log.h"
 #include "counter.h"
+#include "predict.h"
 
 
 #define FOR_SAMPLE_IDX_IN(sample_idxs, body)                                \
@@ -15,16 +19,42 @@
         do { body } while(0); }
 
 
+// --- stats ---
+// every collection point is a single branch when stats are not requested
+
+static inline double stats_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#define STATS_START(tb, t) double t = (tb)->stats ? stats_clock() : 0
+
+#define STATS_STOP(tb, field, t)                                            \
+    if ((tb)->stats) (tb)->stats->field += stats_clock() - (t)
+
+#define STATS_INCR(tb, field, n)                                            \
+    if ((tb)->stats) (tb)->stats->field += (n)
+
+// bytes obtained by a kvec since its capacity was m0
+#define STATS_KV_GROWTH(tb, type, v, m0)                                    \
+    if ((tb)->stats && kv_max(v) > (m0))                                    \
+        (tb)->stats->bytes_allocated += (kv_max(v) - (m0)) * sizeof(type)
+
+
 typedef struct {
     ET_base_node *node;
     uint_vec higher_idxs;
     uint_vec lower_idxs;
     double higher_diversity;
     double lower_diversity;
+    node_labels higher_labels;
+    node_labels lower_labels;
+    uint_vec constant_fids;     // features known to be constant in children
 } builder_stack_node;
 
 
-ET_leaf_node *new_leaf_node(uint_vec *sample_idxs, bool constant) {
+ET_leaf_node *new_leaf_node(uint_vec *sample_idxs, node_labels *labels) {
     ET_leaf_node *ln = NULL;
     ln = malloc(sizeof(ET_leaf_node));
     check_mem(ln);
@@ -33,8 +63,12 @@ ET_leaf_node *new_leaf_node(uint_vec *sample_idxs, bool constant) {
 
     kv_init(ln->indexes);
     kv_copy(uint32_t, ln->indexes, *sample_idxs);
-    ln->constant = constant;
-    ln->base.n_samples = kv_size(*sample_idxs);
+    ln->constant = labels->constant;
+    ln->base.n_samples = labels->weight;
+    ln->summarized = false;
+    ln->label_sum = 0;
+    ln->label = 0;
+    ln->classes = NULL;
 
     exit:
     return ln;
@@ -46,255 +80,491 @@ typedef struct {
 } min_max;
 
 
-min_max get_feature_min_max(ET_problem *prob, uint_vec *sample_idxs,
-                            uint32_t fid) {
-
-    min_max mm = {DBL_MAX, -DBL_MAX};
-
-    FOR_SAMPLE_IDX_IN(*sample_idxs, {
-        float val = PROB_GET(prob, sample_idx, fid);
-        if (val > mm.max) mm.max = val;
-        if (val < mm.min) mm.min = val;
-    });
-
-    return mm;
-}
-
-
-void split_on_threshold(ET_problem *prob, uint32_t feature_idx,
-                                          double threshold,
-                                          uint_vec *sample_idxs,
-                                          uint_vec *higher_idxs,
-                                          uint_vec *lower_idxs) {
-
-    kv_clear(*higher_idxs);
-    kv_clear(*lower_idxs);
-
-    FOR_SAMPLE_IDX_IN(*sample_idxs, {
-        double val = PROB_GET(prob, sample_idx, feature_idx);
-        if (val <= threshold) {
-            log_debug("sample_idx: %d, val: %g -> lower", sample_idx, val);
-            kv_push(uint32_t, *lower_idxs, sample_idx);
-        } else {
-            log_debug("sample_idx: %d, val: %g -> higher", sample_idx, val);
-            kv_push(uint32_t, *higher_idxs, sample_idx);
-        }
-    });
-}
-
+// diversity functions also summarize, from the same pass, the labels of the
+// samples (constancy and weight). Diversity is a sum of non negative terms:
+// as soon as offset + the partial sum reaches bound, the partial sum is
+// returned (the split cannot win).
+// Samples are weighted by their number of occurrences in the problem. Each
+// function has a _weighted and an _unweighted instance, the second never
+// reading weights: weighted is a constant of the inlined body.
+
+#ifdef __GNUC__
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+#define WEIGHT_OF(weighted, weights, sample)                                \
+    ((weighted) ? (weights)[sample] : 1)
+
+#define DIVERSITY_INSTANCES(name)                                           \
+    static double name ## _unweighted(tree_builder *tb,                     \
+                                      uint_vec *sample_idxs, double offset, \
+                                      double bound, node_labels *labels) {  \
+        return name(tb, sample_idxs, offset, bound, labels, false);         \
+    }                                                                       \
+    static double name ## _weighted(tree_builder *tb,                       \
+                                    uint_vec *sample_idxs, double offset,   \
+                                    double bound, node_labels *labels) {    \
+        return name(tb, sample_idxs, offset, bound, labels, true);          \
+    }
 
-double classification_diversity(ET_problem *prob, uint_vec *sample_idxs) {
-    double n_samples = kv_size(*sample_idxs);
+static ALWAYS_INLINE double classification_diversity(tree_builder *tb,
+                                       uint_vec *sample_idxs, double offset,
+                                       double bound, node_labels *labels,
+                                       bool weighted) {
+    ET_problem *prob = tb->prob;
+    double n_samples = 0;
+    double square_sum = 0;      // of the class weights counted so far
     double gini_diversity = 0.0;
     ET_class_counter class_counter;
 
     ET_class_counter_init(class_counter);
 
-
-    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+    // the diversity of the samples counted so far, n_samples - square_sum /
+    // n_samples, never decreases as samples are added: once it reaches the
+    // bound, so does the diversity of the node, and labels are not needed
+    for(size_t i = 0; i < kv_size(*sample_idxs); i++) {
+        uint32_t sample_idx = kv_A(*sample_idxs, i);
         double label = prob->labels[sample_idx];
-        ET_class_counter_incr(&class_counter, label);
-    });
+        uint32_t weight = WEIGHT_OF(weighted, prob->weights, sample_idx);
+        class_counter_elm *cce;
+
+        kal_getp(class_counter, label, cce);
+        if (cce == NULL) {
+            kv_push(class_counter_elm, class_counter,
+                    ((class_counter_elm) {label, 0}));
+            cce = &kv_last(class_counter);
+        }
+        square_sum += (2.0 * cce->count + weight) * weight;
+        cce->count += weight;
+        n_samples += weight;
+        if (n_samples > 0 &&
+            offset + (n_samples - square_sum / n_samples) >= bound) {
+            gini_diversity = n_samples - square_sum / n_samples;
+            goto exit;
+        }
+    }
+    labels->constant = kv_size(class_counter) <= 1;
+    labels->weight = n_samples;
 
     log_debug("class counter:");
     for(size_t i = 0; i < kv_size(class_counter); i++) {
-        double class;
-        uint32_t count;
-        class = kv_A(class_counter, i).key;
-        count = kv_A(class_counter, i).count;
+        uint32_t count = kv_A(class_counter, i).count;
 
-        log_debug("    > class: %g count:%d", class, count);
+        log_debug("    > class: %g count:%d", kv_A(class_counter, i).key,
+                  count);
 
         gini_diversity += count * (1.0 - count / n_samples);
+        if (offset + gini_diversity >= bound) break;
     }
     log_debug("gini index: %g", gini_diversity / n_samples);
 
+    exit:
     ET_class_counter_destroy(class_counter);
     return gini_diversity;
 }
+DIVERSITY_INSTANCES(classification_diversity)
 
 
-double regression_diversity(ET_problem *prob, uint_vec *sample_idxs) {
+static ALWAYS_INLINE double regression_diversity(tree_builder *tb,
+                                                 uint_vec *sample_idxs,
+                                                 double offset, double bound,
+                                                 node_labels *labels,
+                                                 bool weighted) {
 
+    ET_problem *prob = tb->prob;
     double mean = 0;
     uint32_t count = 0;
     double diversity = 0;
-
-    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+    double first_label = 0;
+    double running_mean = 0, running_squares = 0;
+
+    // the sum of squares of the samples seen so far (Welford) never
+    // decreases as samples are added: once it reaches the bound, so does
+    // the diversity of the node. Otherwise the returned diversity is that of
+    // the second pass, around the exact mean
+    labels->constant = true;
+    for(size_t i = 0; i < kv_size(*sample_idxs); i++) {
+        uint32_t sample_idx = kv_A(*sample_idxs, i);
         double label = prob->labels[sample_idx];
-        mean += label;
-        count++;
-    });
+        uint32_t weight = WEIGHT_OF(weighted, prob->weights, sample_idx);
+        double delta = label - running_mean;
+
+        if (i == 0) {
+            first_label = label;
+        } else if (first_label != label) {
+            labels->constant = false;
+        }
+        mean += weight * label;
+        count += weight;
+        if (weight == 0) continue;
+        running_mean += delta * weight / count;
+        running_squares += weight * delta * (label - running_mean);
+        if (offset + running_squares >= bound) return running_squares;
+    }
     mean /= count;
+    labels->weight = count;
 
-    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+    for(size_t i = 0; i < kv_size(*sample_idxs); i++) {
+        uint32_t sample_idx = kv_A(*sample_idxs, i);
         double label = prob->labels[sample_idx];
-        diversity += pow(label - mean,  2);
-    })
+        diversity += WEIGHT_OF(weighted, prob->weights, sample_idx) *
+                     pow(label - mean,  2);
+        if (offset + diversity >= bound) break;
+    }
     return diversity;
 }
+DIVERSITY_INSTANCES(regression_diversity)
 
 
-void split_problem(tree_builder *tb, uint_vec *sample_idxs,
-                   builder_stack_node *stack_node) {
+// * mad
 
-    bool labels_are_constant = true;
-    ET_base_node *node = NULL;
-    bool split_found = false;
-    double best_threshold = 0;       // initialized to silence compiler warn
-    uint32_t best_feature_idx = 0.0; // initialized to silence compiler warn
-    ET_problem *prob = tb->prob;
+static inline void swap_values(double *values, int64_t a, int64_t b) {
+    double tmp = values[a];
+    values[a] = values[b];
+    values[b] = tmp;
+}
 
-    double higher_diversity, lower_diversity;
-    uint_vec lower_idxs, higher_idxs;
-    kv_init(lower_idxs); kv_init(higher_idxs);
+// k-th smallest of values (quickselect, median of three pivot). Values are
+// reordered.
+static double select_kth(double *values, int64_t n, int64_t k) {
+    int64_t lo = 0, hi = n - 1;
 
-    log_debug(">>>>> split_problem. n samples: %zu", kv_size(*sample_idxs));
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2, i = lo, j = hi;
+        double pivot;
 
-    // check if min_split_size is reached
-    // NOTE: this does not guarantee that leaf size is always >= min_split_size
-    if(kv_size(*sample_idxs) < (size_t) tb->params.min_split_size) {
-        log_debug("min_split_size (%d) NOT reached. sample size: %zu",
-                                                    tb->params.min_split_size,
-                                                    kv_size(*sample_idxs));
-        node = (ET_base_node *) new_leaf_node(sample_idxs, false);
-        goto exit;
-    }
+        if (values[mid] < values[lo]) swap_values(values, lo, mid);
+        if (values[hi]  < values[lo]) swap_values(values, lo, hi);
+        if (values[hi]  < values[mid]) swap_values(values, mid, hi);
+        pivot = values[mid];
 
-    // check if labels are constant
-    {
-        double first_label = 0;
-        FOR_SAMPLE_IDX_IN(*sample_idxs, {
-            double label = prob->labels[sample_idx];
-            if (i == 0) {
-                first_label = label;
-            } else if (first_label != label) {
-                labels_are_constant = false;
-                break;
-            }
-        });
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (values[j] > pivot) j--;
+            if (i <= j) swap_values(values, i++, j--);
+        }
+        if (k <= j) {
+            hi = j;
+        } else if (k >= i) {
+            lo = i;
+        } else {
+            break;
+        }
     }
+    return values[k];
+}
+
+static inline void swap_value_weights(double *value_weights, int64_t a,
+                                      int64_t b) {
+    swap_values(value_weights, 2 * a, 2 * b);
+    swap_values(value_weights, 2 * a + 1, 2 * b + 1);
+}
 
-    // if labels are constant return leaf node
-    if(labels_are_constant) {
-        log_debug("labels are constant. generating leaf node ...");
-        node = (ET_base_node *) new_leaf_node(sample_idxs, true);
-        goto exit;
+// weighted median of (value, weight) pairs: the first value, in increasing
+// order, where the cumulated weight reaches half of total_weight. The
+// partitioning of select_kth, going on in the side holding that point.
+// Pairs are reordered.
+static double weighted_median(double *value_weights, int64_t n,
+                              uint32_t total_weight) {
+    double *vw = value_weights;
+    double before = 0;          // weight of the pairs left of lo
+    int64_t lo = 0, hi = n - 1;
+
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2, i = lo, j = hi;
+        double pivot, lower_weight = 0, pivot_weight = 0;
+
+        if (vw[2 * mid] < vw[2 * lo]) swap_value_weights(vw, lo, mid);
+        if (vw[2 * hi]  < vw[2 * lo]) swap_value_weights(vw, lo, hi);
+        if (vw[2 * hi]  < vw[2 * mid]) swap_value_weights(vw, mid, hi);
+        pivot = vw[2 * mid];
+
+        while (i <= j) {
+            while (vw[2 * i] < pivot) i++;
+            while (vw[2 * j] > pivot) j--;
+            if (i <= j) swap_value_weights(vw, i++, j--);
+        }
+        // [lo, j] <= pivot, (j, i) == pivot, [i, hi] >= pivot
+        for(int64_t k = lo; k <= j; k++) lower_weight += vw[2 * k + 1];
+        for(int64_t k = j + 1; k < i; k++) pivot_weight += vw[2 * k + 1];
+
+        if (2 * (before + lower_weight) >= total_weight) {
+            hi = j;
+        } else if (2 * (before + lower_weight + pivot_weight) >=
+                                                            total_weight) {
+            return pivot;
+        } else {
+            before += lower_weight + pivot_weight;
+            lo = i;
+        }
     }
+    return vw[2 * lo];
+}
 
-    {
-        double best_diversity = DBL_MAX;
-        uint32_t n_features = prob->n_features;
-        uint32_t nb_features_tested = 0;
-        uint32_t nb_features_to_test = tb->params.number_of_features_tested;
-        bool with_replacement = tb->params.select_features_with_replacement;
+// sum of absolute deviations from the median. Quickselect keeps it linear
+// (on average) in the node size, as the two passes of the variance, with
+// or without weights.
+// Labels are always read in double precision.
+static ALWAYS_INLINE double regression_mad_diversity(tree_builder *tb,
+                                                     uint_vec *sample_idxs,
+                                                     double offset,
+                                                     double bound,
+                                                     node_labels *labels,
+                                                     bool weighted) {
+    ET_problem *prob = tb->prob;
+    double *values = tb->mad_values;
+    int64_t n_samples = kv_size(*sample_idxs);
+    double median, diversity = 0;
 
-        uint32_t max_test = with_replacement ? 10 * n_features : n_features;
+    labels->constant = true;
+    if (weighted) {
+        labels->weight = 0;
+        FOR_SAMPLE_IDX_IN(*sample_idxs, {
+            values[2 * i] = prob->labels[sample_idx];
+            values[2 * i + 1] = prob->weights[sample_idx];
+            labels->weight += prob->weights[sample_idx];
+            if (values[2 * i] != values[0]) labels->constant = false;
+        });
+        if (labels->constant) return 0;
 
-        log_debug("number of features to test: %d", nb_features_to_test);
+        median = weighted_median(values, n_samples, labels->weight);
+        log_debug("median: %g", median);
 
-        // select best split
-        while (nb_features_to_test && nb_features_tested < max_test) {
-            min_max mm;
-            uint32_t feature_idx;
-            double threshold, diversity;
+        for(int64_t i = 0; i < n_samples; i++) {
+            diversity += values[2 * i + 1] * fabs(values[2 * i] - median);
+            if (offset + diversity >= bound) break;
+        }
+        return diversity;
+    }
 
-            log_debug("--- new loop cycle ---");
+    labels->weight = n_samples;
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        values[i] = prob->labels[sample_idx];
+        if (values[i] != values[0]) labels->constant = false;
+    });
+    if (labels->constant) return 0;
 
-            // select random feature
-            if (with_replacement) {
-                feature_idx = random_int(&tb->rand_state, prob->n_features);
-            } else {
-                uint32_t deck_idx, end_idx, *deck;
-
-                deck = tb->features_deck;
-                deck_idx = random_int(&tb->rand_state,
-                                      prob->n_features - nb_features_tested);
-                feature_idx = deck[deck_idx];
-                end_idx = prob->n_features - nb_features_tested - 1;
-                deck[deck_idx] = deck[end_idx];
-                deck[end_idx] = feature_idx;
-            }
-            nb_features_tested++;
-            log_debug("number of feature selected %s replacement: %d",
-                    with_replacement ? "WITH" : "WITHOUT", nb_features_tested);
-            log_debug("feature index: %d", feature_idx);
-
-            // select random threshold in (min, max)
-            mm = get_feature_min_max(prob, sample_idxs, feature_idx);
-            log_debug("values - min: %g max: %g", mm.min, mm.max);
-            if (mm.min == mm.max) {
-                log_debug("constant feature");
-                continue;
-            } else {
-                split_found = true;
-            }
+    median = select_kth(values, n_samples, (n_samples - 1) / 2);
+    log_debug("median: %g", median);
 
-            double delta = mm.max - mm.min;
-            threshold = mm.min + random_double(&tb->rand_state) * delta;
+    for(int64_t i = 0; i < n_samples; i++) {
+        diversity += fabs(values[i] - median);
+        if (offset + diversity >= bound) break;
+    }
+    return diversity;
+}
+DIVERSITY_INSTANCES(regression_mad_diversity)
 
-            log_debug("threshold: %g", threshold);
 
-            // evaluate split diversity
-            split_on_threshold(prob, feature_idx, threshold,
-                               sample_idxs, &higher_idxs, &lower_idxs);
-            higher_diversity = tb->diversity_f(prob, &higher_idxs);
-            lower_diversity  = tb->diversity_f(prob, &lower_idxs);
+// * single precision
 
-            diversity = higher_diversity + lower_diversity;
+// Neumaier summation
+static inline void compensated_addf(float *sum, float *compensation,
+                                    float value) {
+    float t = *sum + value;
+    if (fabsf(*sum) >= fabsf(value)) {
+        *compensation += (*sum - t) + value;
+    } else {
+        *compensation += (value - t) + *sum;
+    }
+    *sum = t;
+}
 
-            log_debug("%s diversity: %g", tb->params.regression?"regr":"class",
-                                          diversity);
+static ALWAYS_INLINE double classification_diversity_single(
+                                              tree_builder *tb,
+                                              uint_vec *sample_idxs,
+                                              double offset, double bound,
+                                              node_labels *labels,
+                                              bool weighted) {
+    uint32_t *weights = tb->prob->weights;
+    float n_samples;
+    float gini_diversity = 0.0f;
+    ET_class_counter class_counter;
 
+    ET_class_counter_init(class_counter);
 
-            if (diversity < best_diversity) {
-                log_debug("diversity is new best");
-                best_threshold = threshold;
-                best_feature_idx = feature_idx;
-                best_diversity = diversity;
-                kv_copy(uint32_t, stack_node->higher_idxs, higher_idxs);
-                kv_copy(uint32_t, stack_node->lower_idxs,  lower_idxs);
-                stack_node->higher_diversity = higher_diversity;
-                stack_node->lower_diversity = lower_diversity;
-            }
+    labels->weight = 0;
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        uint32_t weight = WEIGHT_OF(weighted, weights, sample_idx);
+        ET_class_counter_incr_n(&class_counter, tb->single_labels[sample_idx],
+                                weight);
+        labels->weight += weight;
+    });
+    labels->constant = kv_size(class_counter) <= 1;
+    n_samples = labels->weight;
 
-            if (diversity == 0) {
-                log_debug("diversity == 0");
-                break;
-            }
+    log_debug("class counter:");
+    for(size_t i = 0; i < kv_size(class_counter); i++) {
+        uint32_t count = kv_A(class_counter, i).count;
 
-            nb_features_to_test--;
+        log_debug("    > class: %g count:%d", kv_A(class_counter, i).key,
+                                               count);
 
-        }
+        gini_diversity += count * (1.0f - count / n_samples);
+        if (offset + gini_diversity >= bound) break;
     }
+    log_debug("gini index: %g", gini_diversity / n_samples);
 
-    if (split_found) {
-        // let's build a split node ...
-        log_debug("split found. feature_idx: %d, threshold: %g",                                                                best_feature_idx,
-                                                best_threshold);
-        ET_split_node *sn;
-
-        sn = malloc(sizeof(ET_split_node));
-        check_mem(sn);
-        sn->base.type = ET_SPLIT_NODE;
-        sn->base.n_samples = kv_size(*sample_idxs);
-        sn->feature_id = best_feature_idx;
-        sn->threshold = best_threshold;
-        sn->lower_node = NULL;
-        sn->higher_node = NULL;
-        node = (ET_base_node *) sn;
-    } else {
-        log_debug("split NOT found. building leaf node ...");
-        node = (ET_base_node *) new_leaf_node(sample_idxs, false);
-    }
+    ET_class_counter_destroy(class_counter);
+    return gini_diversity;
+}
+DIVERSITY_INSTANCES(classification_diversity_single)
+
+static ALWAYS_INLINE double regression_diversity_single(tree_builder *tb,
+                                                   uint_vec *sample_idxs,
+                                                   double offset,
+                                                   double bound,
+                                                   node_labels *labels,
+                                                   bool weighted) {
+    float *single_labels = tb->single_labels;
+    uint32_t *weights = tb->prob->weights;
+    float sum = 0, compensation = 0, mean;
+    float diversity = 0;
+    float first_label = 0;
+    uint32_t count = 0;
 
-    exit:
-    kv_destroy(lower_idxs);
-    kv_destroy(higher_idxs);
-    stack_node->node = node;
+    labels->constant = true;
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        float label = single_labels[sample_idx];
+        uint32_t weight = WEIGHT_OF(weighted, weights, sample_idx);
+        if (i == 0) {
+            first_label = label;
+        } else if (first_label != label) {
+            labels->constant = false;
+        }
+        compensated_addf(&sum, &compensation, weight * label);
+        count += weight;
+    });
+    mean = (sum + compensation) / count;
+    labels->weight = count;
+
+    // not compensated: a running sum of squares must not decrease, or the
+    // bound check could drop a winning split
+    FOR_SAMPLE_IDX_IN(*sample_idxs, {
+        float delta = single_labels[sample_idx] - mean;
+        diversity += WEIGHT_OF(weighted, weights, sample_idx) * delta * delta;
+        if (offset + diversity >= bound) break;
+    })
+    return diversity;
+}
+DIVERSITY_INSTANCES(regression_diversity_single)
+
+// thresholds are drawn in double precision: round to the float stored in
+// the split node, keeping at least one sample above it
+static inline double single_threshold(double threshold, min_max mm) {
+    float single = (float) threshold;
+    if (single >= mm.max) single = nextafterf((float) mm.max, -INFINITY);
+    return single;
+}
+
+
+static inline void deck_swap(tree_builder *tb, uint32_t a, uint32_t b) {
+    uint32_t *deck = tb->features_deck;
+    uint32_t tmp = deck[a];
+    deck[a] = deck[b];
+    deck[b] = tmp;
+    tb->deck_pos[deck[a]] = a;
+    tb->deck_pos[deck[b]] = b;
 }
 
 
+// --- split search ---
+
+typedef void (*split_function) (tree_builder *tb, uint_vec *sample_idxs,
+                                node_labels *labels,
+                                uint_vec *constant_fids,
+                                builder_stack_node *stack_node);
+
+#define SPLIT_SUFFIX class
+#define SPLIT_DIVERSITY classification_diversity
+#define SPLIT_SINGLE_PRECISION 0
+#include "split.h"
+
+#define SPLIT_SUFFIX regr
+#define SPLIT_DIVERSITY regression_diversity
+#define SPLIT_SINGLE_PRECISION 0
+#include "split.h"
+
+#define SPLIT_SUFFIX mad
+#define SPLIT_DIVERSITY regression_mad_diversity
+#define SPLIT_SINGLE_PRECISION 0
+#include "split.h"
+
+#define SPLIT_SUFFIX class_single
+#define SPLIT_DIVERSITY classification_diversity_single
+#define SPLIT_SINGLE_PRECISION 1
+#include "split.h"
+
+#define SPLIT_SUFFIX regr_single
+#define SPLIT_DIVERSITY regression_diversity_single
+#define SPLIT_SINGLE_PRECISION 1
+#include "split.h"
+
+#define SPLIT_SUFFIX mad_single
+#define SPLIT_DIVERSITY regression_mad_diversity
+#define SPLIT_SINGLE_PRECISION 1
+#include "split.h"
+
+// indexed by [single_precision][task][weighted], task being
+// classification, regression or regression with the mad diversity
+static const diversity_function diversity_functions[2][3][2] = {
+    {{classification_diversity_unweighted,
+      classification_diversity_weighted},
+     {regression_diversity_unweighted,
+      regression_diversity_weighted},
+     {regression_mad_diversity_unweighted,
+      regression_mad_diversity_weighted}},
+    {{classification_diversity_single_unweighted,
+      classification_diversity_single_weighted},
+     {regression_diversity_single_unweighted,
+      regression_diversity_single_weighted},
+     {regression_mad_diversity_unweighted,
+      regression_mad_diversity_weighted}}
+};
+
+// indexed by [single_precision][task][weighted][feature_type]
+static const split_function split_functions[2][3][2][3] = {
+    {{{split_problem_class_unweighted_float32,
+       split_problem_class_unweighted_float64,
+       split_problem_class_unweighted_uint8},
+      {split_problem_class_weighted_float32,
+       split_problem_class_weighted_float64,
+       split_problem_class_weighted_uint8}},
+     {{split_problem_regr_unweighted_float32,
+       split_problem_regr_unweighted_float64,
+       split_problem_regr_unweighted_uint8},
+      {split_problem_regr_weighted_float32,
+       split_problem_regr_weighted_float64,
+       split_problem_regr_weighted_uint8}},
+     {{split_problem_mad_unweighted_float32,
+       split_problem_mad_unweighted_float64,
+       split_problem_mad_unweighted_uint8},
+      {split_problem_mad_weighted_float32,
+       split_problem_mad_weighted_float64,
+       split_problem_mad_weighted_uint8}}},
+    {{{split_problem_class_single_unweighted_float32,
+       split_problem_class_single_unweighted_float64,
+       split_problem_class_single_unweighted_uint8},
+      {split_problem_class_single_weighted_float32,
+       split_problem_class_single_weighted_float64,
+       split_problem_class_single_weighted_uint8}},
+     {{split_problem_regr_single_unweighted_float32,
+       split_problem_regr_single_unweighted_float64,
+       split_problem_regr_single_unweighted_uint8},
+      {split_problem_regr_single_weighted_float32,
+       split_problem_regr_single_weighted_float64,
+       split_problem_regr_single_weighted_uint8}},
+     {{split_problem_mad_single_unweighted_float32,
+       split_problem_mad_single_unweighted_float64,
+       split_problem_mad_single_unweighted_uint8},
+      {split_problem_mad_single_weighted_float32,
+       split_problem_mad_single_weighted_float64,
+       split_problem_mad_single_weighted_uint8}}}
+};
+
+
 //TODO remove recursion
 void tree_destroy(ET_base_node *node) {
     ET_split_node *sn = NULL;
@@ -304,12 +574,20 @@ void tree_destroy(ET_base_node *node) {
         case ET_LEAF_NODE:
             ln = (ET_leaf_node *) node;
             kv_destroy(ln->indexes);
+            if (ln->classes) {
+                ET_class_counter_destroy(*ln->classes);
+                free(ln->classes);
+            }
             free(node);
             break;
         case ET_SPLIT_NODE:
             sn = (ET_split_node *) node;
             tree_destroy((ET_base_node *) sn->higher_node);
             tree_destroy((ET_base_node *) sn->lower_node);
+            if (sn->classes) {
+                ET_class_counter_destroy(*sn->classes);
+                free(sn->classes);
+            }
             free(node);
             break;
         default:
@@ -321,22 +599,174 @@ void tree_destroy(ET_base_node *node) {
 }
 
 
+// groups the root samples by class, for class capped sampling, and sums
+// the weight of each class
+static int class_groups_init(tree_builder *tb) {
+    ET_class_counter *cc = NULL;
+    uint32_t *next = NULL;
+    int ret = -1;
+
+    cc = ET_class_counter_new();
+    check_mem(cc);
+    FOR_SAMPLE_IDX_IN(tb->root_idxs, {
+        ET_class_counter_incr(cc, tb->prob->labels[sample_idx]);
+    });
+    ET_class_counter_sort(cc);
+
+    kv_push(uint32_t, tb->class_offsets, 0);
+    for(size_t k = 0; k < kv_size(*cc); k++) {
+        uint32_t end = kv_last(tb->class_offsets) + kv_A(*cc, k).count;
+        kv_push(uint32_t, tb->class_offsets, end);
+    }
+    next = malloc(kv_size(*cc) * sizeof(uint32_t));
+    check_mem(next);
+    memcpy(next, tb->class_offsets.a, kv_size(*cc) * sizeof(uint32_t));
+
+    kv_resize(uint32_t, tb->class_idxs, kv_size(tb->root_idxs));
+    check_mem(tb->class_idxs.a);
+    kv_size(tb->class_idxs) = kv_size(tb->root_idxs);
+    kv_resize(uint32_t, tb->class_weights, kv_size(*cc));
+    check_mem(tb->class_weights.a);
+    kv_size(tb->class_weights) = kv_size(*cc);
+    memset(tb->class_weights.a, 0, kv_size(*cc) * sizeof(uint32_t));
+    kv_resize(double, tb->class_drawn, kv_size(*cc));
+    check_mem(tb->class_drawn.a);
+    kv_size(tb->class_drawn) = kv_size(*cc);
+    memset(tb->class_drawn.a, 0, kv_size(*cc) * sizeof(double));
+    FOR_SAMPLE_IDX_IN(tb->root_idxs, {
+        class_counter_elm *cce;
+        kal_getp(*cc, tb->prob->labels[sample_idx], cce);
+        kv_A(tb->class_idxs, next[cce - cc->a]++) = sample_idx;
+        kv_A(tb->class_weights, cce - cc->a) +=
+                                SAMPLE_WEIGHT(tb->prob->weights, sample_idx);
+    });
+    log_debug("%zu classes capped to %d samples", kv_size(*cc),
+              tb->params.class_sample_cap);
+    ret = 0;
+
+    exit:
+    if (next) free(next);
+    if (cc) {
+        ET_class_counter_destroy(*cc);
+        free(cc);
+    }
+    return ret;
+}
+
+// draws up to class_sample_cap samples of each class for the next tree.
+// A weighted sample is drawn whole: the last one may exceed the cap, and
+// the weight actually drawn is added to class_drawn
+static void class_groups_sample(tree_builder *tb) {
+    uint32_t cap = tb->params.class_sample_cap;
+    uint32_t *weights = tb->prob->weights;
+
+    kv_clear(tb->tree_idxs);
+    for(size_t k = 0; k + 1 < kv_size(tb->class_offsets); k++) {
+        uint32_t *idxs = &kv_A(tb->class_idxs, kv_A(tb->class_offsets, k));
+        uint32_t n = kv_A(tb->class_offsets, k + 1) -
+                     kv_A(tb->class_offsets, k);
+        uint32_t weight = kv_A(tb->class_weights, k);
+        uint32_t drawn_weight = weight < cap ? weight : cap;
+        uint32_t drawn = 0;
+
+        // partial Fisher-Yates shuffle, in place
+        for(uint32_t j = 0; drawn < drawn_weight; j++) {
+            if (drawn_weight < weight) {
+                uint32_t r = j + random_int(&tb->rand_state, n - j);
+                uint32_t tmp = idxs[j];
+                idxs[j] = idxs[r];
+                idxs[r] = tmp;
+            }
+            kv_push(uint32_t, tb->tree_idxs, idxs[j]);
+            drawn += SAMPLE_WEIGHT(weights, idxs[j]);
+        }
+        kv_A(tb->class_drawn, k) += drawn;
+    }
+}
+
+
 int tree_builder_init(tree_builder *tb, ET_problem *prob,
                       ET_params *params, uint32_t *seed) {
+    ET_problem_view view;
+    ET_problem_view_init(&view, prob);
+    return tree_builder_init_view(tb, &view, params, seed);
+}
+
+
+int tree_builder_init_view(tree_builder *tb, ET_problem_view *view,
+                           ET_params *params, uint32_t *seed) {
+    ET_problem *prob = view->prob;
+
     tb->prob = prob;
+    tb->view = *view;
     simplerandom_kiss2_seed(&tb->rand_state, seed[2], seed[3],
                                              seed[1], seed[0]);
 
     tb->features_deck = NULL;
-    tb->features_deck = malloc(sizeof(uint32_t) * prob->n_features);
+    tb->deck_pos = NULL;
+    tb->single_labels = NULL;
+    tb->mad_values = NULL;
+    kv_init(tb->root_idxs);
+    kv_init(tb->class_idxs);
+    kv_init(tb->class_offsets);
+    kv_init(tb->class_weights);
+    kv_init(tb->class_drawn);
+    kv_init(tb->tree_idxs);
+    tb->root_diversity = -1;
+    tb->root_labels = (node_labels) {false, 0};
+    check(view->n_features > 0 && view->n_samples > 0, "empty problem view");
+    check(prob->feature_type <= ET_UINT8, "unknown feature type: %d",
+                                          prob->feature_type);
+
+    if (view->sample_idxs) {
+        kv_resize(uint32_t, tb->root_idxs, view->n_samples);
+        check_mem(tb->root_idxs.a);
+        for(uint32_t i = 0; i < view->n_samples; i++) {
+            check(view->sample_idxs[i] < prob->n_samples,
+                  "view sample index out of range: %d", view->sample_idxs[i]);
+            kv_A(tb->root_idxs, i) = view->sample_idxs[i];
+        }
+        kv_size(tb->root_idxs) = view->n_samples;
+    } else {
+        kv_range(uint32_t, tb->root_idxs, prob->n_samples);
+        check_mem(tb->root_idxs.a);
+    }
+
+    tb->features_deck = malloc(sizeof(uint32_t) * view->n_features);
     check_mem(tb->features_deck);
-    for(uint32_t i = 0; i < prob->n_features; i++) {
-        tb->features_deck[i] = i;
+    tb->deck_pos = malloc(sizeof(uint32_t) * prob->n_features);
+    check_mem(tb->deck_pos);
+    for(uint32_t i = 0; i < view->n_features; i++) {
+        uint32_t fid = view->feature_idxs ? view->feature_idxs[i] : i;
+        check(fid < prob->n_features, "view feature index out of range: %d",
+                                      fid);
+        tb->features_deck[i] = fid;
+        tb->deck_pos[fid] = i;
     }
 
     tb->params = *params;
-    tb->diversity_f = (tb->params.regression) ? regression_diversity :
-                                                classification_diversity;
+    if (tb->params.single_precision) {
+        tb->single_labels = malloc(prob->n_samples * sizeof(float));
+        check_mem(tb->single_labels);
+        for(uint32_t i = 0; i < prob->n_samples; i++) {
+            tb->single_labels[i] = prob->labels[i];
+        }
+    }
+    tb->diversity_f = diversity_functions[tb->params.single_precision]
+                                         [tb->params.regression ?
+                                            1 + tb->params.mad_diversity : 0]
+                                         [prob->weights != NULL];
+    if (tb->params.regression && tb->params.mad_diversity) {
+        // a node never holds more samples than the root. Weighted problems
+        // store (value, weight) pairs
+        tb->mad_values = malloc((prob->weights ? 2 : 1) * view->n_samples *
+                                sizeof(double));
+        check_mem(tb->mad_values);
+    }
+    if (! tb->params.regression && tb->params.class_sample_cap) {
+        check(! class_groups_init(tb), "could not group samples by class");
+    }
+    tb->stats = NULL;
 
     return 0;
 
@@ -347,6 +777,15 @@ int tree_builder_init(tree_builder *tb, ET_problem *prob,
 
 void tree_builder_destroy(tree_builder *tb) {
     if (tb->features_deck) free(tb->features_deck);
+    if (tb->deck_pos) free(tb->deck_pos);
+    if (tb->single_labels) free(tb->single_labels);
+    if (tb->mad_values) free(tb->mad_values);
+    kv_destroy(tb->root_idxs);
+    kv_destroy(tb->class_idxs);
+    kv_destroy(tb->class_offsets);
+    kv_destroy(tb->class_weights);
+    kv_destroy(tb->class_drawn);
+    kv_destroy(tb->tree_idxs);
 }
 
 
@@ -354,45 +793,70 @@ ET_tree build_tree(tree_builder *tb) {
     ET_tree tree = NULL;
     kvec_t(builder_stack_node) stack;
     builder_stack_node *curr_snode;
+    uint_vec *root_idxs = &tb->root_idxs;
+    uint_vec no_constant_fids = {0, 0, NULL};
+    split_function split_problem =
+        split_functions[tb->params.single_precision]
+                       [tb->params.regression ?
+                            1 + tb->params.mad_diversity : 0]
+                       [tb->prob->weights != NULL]
+                       [tb->prob->feature_type];
 
     // general initialization
     kv_init(stack);
     kv_resize(builder_stack_node, stack, tb->prob->n_samples);
 
     {
-        double diversity = -1;
-        uint_vec sample_idxs;
-        kv_init(sample_idxs);
-        kv_range(uint32_t, sample_idxs, tb->prob->n_samples);
+        // root samples and diversity are the same for every tree, unless
+        // classes are capped
+        if (kv_size(tb->class_offsets)) {
+            class_groups_sample(tb);
+            root_idxs = &tb->tree_idxs;
+            tb->root_diversity = -1;
+            tb->root_labels = (node_labels) {false, 0};
+        }
+        if (tb->root_diversity < 0) {
+            STATS_START(tb, t_diversity);
+            tb->root_diversity = tb->diversity_f(tb, root_idxs,
+                                                 0, DBL_MAX,
+                                                 &tb->root_labels);
+            STATS_STOP(tb, diversity_time, t_diversity);
+            STATS_INCR(tb, n_samples_scanned, kv_size(*root_idxs));
+        }
 
         // stack initialization
         curr_snode = ( kv_pushp(builder_stack_node, stack) );
         kv_init(curr_snode->higher_idxs);
         kv_init(curr_snode->lower_idxs);
+        kv_init(curr_snode->constant_fids);
 
-        diversity = tb->diversity_f(tb->prob, &sample_idxs);
-        log_debug("node diversity for next split: %g", diversity);
-        split_problem(tb, &sample_idxs, curr_snode);
+        log_debug("node diversity for next split: %g", tb->root_diversity);
+        split_problem(tb, root_idxs, &tb->root_labels,
+                      &no_constant_fids, curr_snode);
         check_mem(curr_snode->node);
-        curr_snode->node->diversity = diversity;
-        kv_destroy(sample_idxs);
+        curr_snode->node->diversity = tb->root_diversity;
     }
 
     while (kv_size(stack) > 0) {
         bool link_to_parent_required = false;
         uint_vec *curr_sample_idxs = NULL;
         double curr_diversity = -1;
+        node_labels *curr_labels = NULL;
+        uint_vec *curr_constant_fids = NULL;
         curr_snode = &kv_last(stack);
 
         if (IS_SPLIT(curr_snode->node)) {
             ET_split_node *sn = CAST_SPLIT(curr_snode->node);
+            curr_constant_fids = &curr_snode->constant_fids;
 
             if (sn->higher_node == NULL) {
                 curr_sample_idxs = &curr_snode->higher_idxs;
                 curr_diversity = curr_snode->higher_diversity;
+                curr_labels = &curr_snode->higher_labels;
             } else if (sn->lower_node == NULL) {
                 curr_sample_idxs = &curr_snode->lower_idxs;
                 curr_diversity = curr_snode->lower_diversity;
+                curr_labels = &curr_snode->lower_labels;
             } else {
                 link_to_parent_required = true;
             }
@@ -408,6 +872,7 @@ ET_tree build_tree(tree_builder *tb) {
             if (kv_size(stack) == 0) {
                 kv_destroy(curr_snode->higher_idxs);
                 kv_destroy(curr_snode->lower_idxs);
+                kv_destroy(curr_snode->constant_fids);
                 tree = curr_snode->node;
                 break;
             }
@@ -424,13 +889,16 @@ ET_tree build_tree(tree_builder *tb) {
             }
             kv_destroy(curr_snode->higher_idxs);
             kv_destroy(curr_snode->lower_idxs);
+            kv_destroy(curr_snode->constant_fids);
 
         } else {
             curr_snode = ( kv_pushp(builder_stack_node, stack) );
             kv_init(curr_snode->higher_idxs);
             kv_init(curr_snode->lower_idxs);
+            kv_init(curr_snode->constant_fids);
             log_debug("node diversity for next split: %g", curr_diversity);
-            split_problem(tb, curr_sample_idxs, curr_snode);
+            split_problem(tb, curr_sample_idxs, curr_labels,
+                          curr_constant_fids, curr_snode);
             check_mem(curr_snode->node);
             curr_snode->node->diversity = curr_diversity;
         }
@@ -443,38 +911,209 @@ ET_tree build_tree(tree_builder *tb) {
 
 
 ET_forest *ET_forest_build(ET_problem *prob, ET_params *params) {
+    return ET_forest_build_stats(prob, params, NULL);
+}
+
+
+ET_forest *ET_forest_build_stats(ET_problem *prob, ET_params *params,
+                                 ET_train_stats *stats) {
+    ET_problem_view view;
+    ET_problem_view_init(&view, prob);
+    return ET_forest_build_view(&view, params, stats);
+}
+
+
+ET_forest *ET_forest_build_view(ET_problem_view *view, ET_params *params,
+                                ET_train_stats *stats) {
+    uint32_t seed[4] = ET_DEFAULT_SEED;
+    return forest_build(view, params, seed, stats);
+}
+
+
+// the forest refers to the samples and features of the parent problem
+ET_forest *forest_build(ET_problem_view *view, ET_params *params,
+                        uint32_t *seed, ET_train_stats *stats) {
+    ET_problem *prob = view->prob;
     ET_forest *forest = NULL;
     ET_tree tree = NULL;
     tree_builder tb;
-    // random seed obtained from mersenne twister invocation
-    uint32_t seed[4] = {3346013320, 826458053, 1844335739, 274945865};
-
+    bool error = true;
+    double t_build = stats ? stats_clock() : 0;
+
+    tb.features_deck = NULL;
+    tb.deck_pos = NULL;
+    tb.single_labels = NULL;
+    tb.mad_values = NULL;
+    kv_init(tb.root_idxs);
+    kv_init(tb.class_idxs);
+    kv_init(tb.class_offsets);
+    kv_init(tb.class_weights);
+    kv_init(tb.class_drawn);
+    kv_init(tb.tree_idxs);
     forest = malloc(sizeof(ET_forest));
     check_mem(forest);
     forest->params = *params;
     forest->n_samples  = prob->n_samples;
     forest->n_features = prob->n_features;
-    forest->labels = malloc(prob->n_samples * sizeof(double));
     forest->class_frequency = NULL;
+    forest->label_order = NULL;
+    forest->label_ranks = NULL;
+    forest->weights = NULL;
+    forest->splits_summarized = false;
+    kv_init(forest->trees);
+    kv_init(forest->class_correction);
+    forest->labels = malloc(prob->n_samples * sizeof(double));
     check_mem(forest->labels);
     memcpy(forest->labels, prob->labels, prob->n_samples * sizeof(double));
+    check_mem(! compute_label_order(forest));
+    // samples outside the view weigh 0: class priors are those of the view
+    if (view->sample_idxs) {
+        forest->weights = calloc(prob->n_samples, sizeof(uint32_t));
+        check_mem(forest->weights);
+        for(uint32_t i = 0; i < view->n_samples; i++) {
+            uint32_t sample_idx = view->sample_idxs[i];
+            check(sample_idx < prob->n_samples,
+                  "view sample index out of range: %d", sample_idx);
+            forest->weights[sample_idx] = SAMPLE_WEIGHT(prob->weights,
+                                                        sample_idx);
+        }
+    } else if (prob->weights) {
+        forest->weights = malloc(prob->n_samples * sizeof(uint32_t));
+        check_mem(forest->weights);
+        memcpy(forest->weights, prob->weights,
+               prob->n_samples * sizeof(uint32_t));
+    }
+    check_mem(! compute_class_frequency(forest));
 
-    kv_init(forest->trees);
-    check_mem(! tree_builder_init(&tb, prob, params, seed) );
+    check(! tree_builder_init_view(&tb, view, params, seed),
+          "could not initialize tree builder");
+    tb.stats = stats;
 
     for(uint32_t i = 0; i < params->number_of_trees; i++) {
+        double t_tree = stats ? stats_clock() : 0;
         log_debug("***** building tree # %d *****", i);
         tree = build_tree(&tb);
         check_mem(tree);
         kv_push(ET_tree, forest->trees, tree);
+        check_mem(! ET_tree_summarize(forest, tree));
+        if (stats) kv_push(double, stats->tree_time, stats_clock() - t_tree);
+    }
+
+    // each drawn sample of a class stands for weight / drawn_weight samples,
+    // drawn_weight being the mean weight drawn per tree: it exceeds the cap
+    // when the last weighted sample drawn does
+    for(size_t k = 0; k + 1 < kv_size(tb.class_offsets); k++) {
+        uint32_t first = kv_A(tb.class_offsets, k);
+        uint32_t weight = kv_A(tb.class_weights, k);
+        double drawn_weight = weight < params->class_sample_cap ?
+                              weight : params->class_sample_cap;
+        if (params->number_of_trees) {
+            drawn_weight = kv_A(tb.class_drawn, k) / params->number_of_trees;
+        }
+        kv_push(double, forest->class_correction,
+                prob->labels[kv_A(tb.class_idxs, first)]);
+        kv_push(double, forest->class_correction, weight / drawn_weight);
     }
+    error = false;
 
     exit:
+    if (error && forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+        forest = NULL;
+    }
     tree_builder_destroy(&tb);
+    if (stats) stats->total_time += stats_clock() - t_build;
     return forest;
 }
 
 
+void ET_train_stats_init(ET_train_stats *stats) {
+    memset(stats, 0, sizeof(ET_train_stats));
+    kv_init(stats->tree_time);
+}
+
+
+void ET_train_stats_destroy(ET_train_stats *stats) {
+    kv_destroy(stats->tree_time);
+}
+
+
+void ET_train_stats_print(ET_train_stats *stats, FILE *fout) {
+    size_t n_trees = kv_size(stats->tree_time);
+
+    fprintf(fout, "train stats: trees=%zu total_time=%.6fs\n", n_trees,
+                                                        stats->total_time);
+    fprintf(fout, "  random:    %.6fs\n", stats->random_time);
+    fprintf(fout, "  min_max:   %.6fs\n", stats->min_max_time);
+    fprintf(fout, "  split:     %.6fs\n", stats->split_time);
+    fprintf(fout, "  diversity: %.6fs\n", stats->diversity_time);
+    fprintf(fout, "  alloc:     %.6fs\n", stats->alloc_time);
+    fprintf(fout, "  nodes=%llu leaves=%llu candidate_splits=%llu\n",
+            (unsigned long long) stats->n_nodes,
+            (unsigned long long) stats->n_leaves,
+            (unsigned long long) stats->n_candidate_splits);
+    fprintf(fout, "  samples_scanned=%llu constant_features=%llu "
+                  "bytes_allocated=%llu\n",
+            (unsigned long long) stats->n_samples_scanned,
+            (unsigned long long) stats->n_constant_features,
+            (unsigned long long) stats->bytes_allocated);
+}
+
+
+int ET_forest_merge(ET_forest *forest, ET_forest *other) {
+    check(forest->n_features == other->n_features &&
+          forest->n_samples  == other->n_samples,
+          "cannot merge forests trained on different problems");
+    check(forest->params.regression == other->params.regression,
+          "cannot merge regression and classification forests");
+    check(! memcmp(forest->labels, other->labels,
+                   forest->n_samples * sizeof(double)),
+          "cannot merge forests trained on different labels");
+    check((forest->weights == NULL) == (other->weights == NULL) &&
+          (forest->weights == NULL ||
+           ! memcmp(forest->weights, other->weights,
+                    forest->n_samples * sizeof(uint32_t))),
+          "cannot merge forests trained on different weights");
+    check(kv_size(forest->class_correction) ==
+                                        kv_size(other->class_correction),
+          "cannot merge forests with different class sampling");
+    for(size_t k = 0; k < kv_size(forest->class_correction); k += 2) {
+        check(kv_A(forest->class_correction, k) ==
+                                        kv_A(other->class_correction, k),
+              "cannot merge forests with different class sampling");
+    }
+
+    // the moved trees are summarized as those of forest, as if loaded
+    for(size_t i = 0; i < kv_size(other->trees); i++) {
+        check_mem(! ET_tree_summarize(forest, kv_A(other->trees, i)));
+    }
+
+    // weight / factor is the mean weight drawn per tree: merged, it is
+    // averaged over the trees of both forests
+    for(size_t k = 1; k < kv_size(forest->class_correction); k += 2) {
+        double n_trees = kv_size(forest->trees);
+        double n_other_trees = kv_size(other->trees);
+        double factor = kv_A(forest->class_correction, k);
+        double other_factor = kv_A(other->class_correction, k);
+        if (factor == other_factor) continue;
+        kv_A(forest->class_correction, k) = (n_trees + n_other_trees) /
+                                            (n_trees / factor +
+                                             n_other_trees / other_factor);
+    }
+
+    // trees are moved: other is left empty but still needs to be destroyed
+    kv_extend(ET_tree, forest->trees, other->trees);
+    kv_clear(other->trees);
+    forest->params.number_of_trees = kv_size(forest->trees);
+    other->params.number_of_trees = 0;
+    return 0;
+
+    exit:
+    return -1;
+}
+
+
 void ET_forest_destroy(ET_forest *forest) {
     for(uint32_t i = 0; i < kv_size(forest->trees); i++) {
         ET_tree t = kv_A(forest->trees, i);
@@ -482,8 +1121,12 @@ void ET_forest_destroy(ET_forest *forest) {
     }
     kv_destroy(forest->trees);
     free(forest->labels);
+    if(forest->weights) free(forest->weights);
+    kv_destroy(forest->class_correction);
     if(forest->class_frequency) {
         ET_class_counter_destroy(*forest->class_frequency);
         free(forest->class_frequency);
     }
+    if(forest->label_order) free(forest->label_order);
+    if(forest->label_ranks) free(forest->label_ranks);
 }
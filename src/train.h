@@ -4,17 +4,45 @@
 #include "simplerandom.h"
 #include "kvec.h"
 
+// random seed obtained from mersenne twister invocation
+#define ET_DEFAULT_SEED {3346013320, 826458053, 1844335739, 274945865}
+
 
 // --- builder ---
 
-typedef double (*diversity_function) (ET_problem *prob, uint_vec *sample_idxs);
+struct tree_builder;
+
+// labels of a node, summarized by the diversity pass of its parent
+typedef struct {
+    bool constant;
+    uint32_t weight;            // number of samples, counting duplicates
+} node_labels;
+
+typedef double (*diversity_function) (struct tree_builder *tb,
+                                      uint_vec *sample_idxs,
+                                      double offset, double bound,
+                                      node_labels *labels);
 
 typedef struct tree_builder {
     ET_problem *prob;
+    ET_problem_view view;
     ET_params params;
     SimpleRandomKISS2_t rand_state;
-    uint32_t *features_deck;
+    uint32_t *features_deck;    // feature ids of the view
+    uint32_t *deck_pos;         // position in features_deck of each feature
+    uint_vec root_idxs;         // samples of the view
+    double root_diversity;      // computed by the first build_tree
+    uint_vec class_idxs;        // root samples grouped by class, if capped
+    uint_vec class_offsets;     // class boundaries in class_idxs
+    uint_vec class_weights;     // weight of the samples of each class
+    double_vec class_drawn;     // weight drawn from each class, summed over
+                                // the trees built
+    uint_vec tree_idxs;         // per class capped samples of the tree
+    node_labels root_labels;
+    float *single_labels;       // labels, in single precision mode
+    double *mad_values;         // median selection buffer, mad diversity
     diversity_function diversity_f;
+    ET_train_stats *stats;
 } tree_builder;
 
 
@@ -23,7 +51,11 @@ typedef struct tree_builder {
 ET_tree build_tree(tree_builder *tb);
 int tree_builder_init(tree_builder *tb, ET_problem *prob, ET_params *params,
                       uint32_t *seed);
+int tree_builder_init_view(tree_builder *tb, ET_problem_view *view,
+                           ET_params *params, uint32_t *seed);
 void tree_builder_destroy(tree_builder *tb);
 void tree_destroy(ET_base_node *bn);
+ET_forest *forest_build(ET_problem_view *view, ET_params *params,
+                        uint32_t *seed, ET_train_stats *stats);
 
 #endif
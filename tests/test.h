@@ -9,8 +9,10 @@
     do {                                                                       \
         (p)->vectors = _vectors;                                               \
         (p)->labels = _labels;                                                 \
+        (p)->weights = NULL;                                                   \
         (p)->n_samples  = sizeof(_labels) /sizeof(*_labels);                   \
         (p)->n_features = sizeof(_vectors)/sizeof(*_vectors) / (p)->n_samples; \
+        (p)->feature_type = ET_FLOAT32;                                        \
     } while(0);
 
 #endif
@@ -0,0 +1,153 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "extratrees.h"
+#include "test.h"
+
+
+float vectors[] = { 2, 2, 2, 3, 3, 3, 4, 4, 4, 1, 2, 3,
+                    2, 3, 2, 3, 2, 3, 4, 5, 4, 1, 1, 2,
+                    1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3 };
+double labels[] = { 2, 2, 2, 1, 1, 1, 0, 0, 0, 2, 2, 1 };
+
+
+// threads log concurrently: keep their debug output out of the reference
+static int silence_stderr(void) {
+    int saved_stderr = dup(2);
+    int devnull = open("/dev/null", O_WRONLY);
+    fflush(stderr);
+    dup2(devnull, 2);
+    close(devnull);
+    return saved_stderr;
+}
+
+static void restore_stderr(int saved_stderr) {
+    dup2(saved_stderr, 2);
+    close(saved_stderr);
+}
+
+
+void test_cross_validation() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    double *scores[2];
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+
+    for(int regression = 0; regression <= 1; regression++) {
+        if (regression) {
+            EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+        } else {
+            EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+        }
+        params.number_of_trees = 10;
+
+        for(int stratified = 0; stratified <= 1; stratified++) {
+            saved_stderr = silence_stderr();
+            scores[0] = ET_forest_cross_validate(&prob, &params, 4,
+                                                 stratified, 1);
+            scores[1] = ET_forest_cross_validate(&prob, &params, 4,
+                                                 stratified, 3);
+            restore_stderr(saved_stderr);
+
+            fprintf(stderr, "regression: %d stratified: %d\n",
+                    regression, stratified);
+            for(int fold = 0; fold < 4; fold++) {
+                fprintf(stderr, "    fold #%d score: %g (3 threads: %g)\n",
+                        fold, scores[0][fold], scores[1][fold]);
+            }
+            free(scores[0]);
+            free(scores[1]);
+        }
+    }
+}
+
+
+// score of a forest built on its own, to be compared with the sweep
+static double single_score(ET_problem_view *train_view,
+                           ET_problem_view *test_view, ET_params *params) {
+    ET_forest *forest = ET_forest_build_view(train_view, params, NULL);
+    ET_problem *prob = test_view->prob;
+    float vector[3];
+    double loss = 0;
+
+    for(uint32_t i = 0; i < test_view->n_samples; i++) {
+        uint32_t sample_idx = test_view->sample_idxs[i];
+        double label = prob->labels[sample_idx], y;
+        for(uint32_t fid = 0; fid < 3; fid++) {
+            vector[fid] = ((float *) prob->vectors)[fid * prob->n_samples +
+                                                    sample_idx];
+        }
+        if (params->regression) {
+            y = ET_forest_predict_regression(forest, vector, 1);
+            loss += (y - label) * (y - label);
+        } else {
+            y = ET_forest_predict_class_majority(forest, vector, 1);
+            loss += y != label;
+        }
+    }
+    ET_forest_destroy(forest);
+    free(forest);
+    return loss / test_view->n_samples;
+}
+
+
+void test_sweep() {
+    test_header();
+
+    ET_problem prob;
+    ET_problem_view train_view, test_view;
+    ET_params grid[6];
+    uint32_t train_idxs[] = {0, 1, 3, 4, 6, 7, 9, 11};
+    uint32_t test_idxs[] = {2, 5, 8, 10};
+    uint32_t n_trees[] = {6, 2, 10};
+    double *scores, expected;
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+    ET_problem_view_init(&train_view, &prob);
+    train_view.sample_idxs = train_idxs;
+    train_view.n_samples = 8;
+    ET_problem_view_init(&test_view, &prob);
+    test_view.sample_idxs = test_idxs;
+    test_view.n_samples = 4;
+
+    for(int regression = 0; regression <= 1; regression++) {
+        for(int config = 0; config < 6; config++) {
+            if (regression) {
+                EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, grid[config]);
+            } else {
+                EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, grid[config]);
+            }
+            grid[config].number_of_trees = n_trees[config % 3];
+            grid[config].min_split_size = config < 3 ? 2 : 4;
+        }
+
+        saved_stderr = silence_stderr();
+        scores = ET_forest_sweep(&train_view, &test_view, grid, 6, 2);
+        restore_stderr(saved_stderr);
+
+        fprintf(stderr, "regression: %d\n", regression);
+        for(int config = 0; config < 6; config++) {
+            saved_stderr = silence_stderr();
+            expected = single_score(&train_view, &test_view, &grid[config]);
+            restore_stderr(saved_stderr);
+            fprintf(stderr, "    trees: %2d min split: %d score: %g "
+                    "(single forest: %g)\n", grid[config].number_of_trees,
+                    grid[config].min_split_size, scores[config], expected);
+        }
+        free(scores);
+    }
+}
+
+
+int main() {
+    test_cross_validation();
+    test_sweep();
+    return 0;
+}
@@ -1,5 +1,15 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+
 #include "extratrees.h"
+#include "predict.h"
 #include "test.h"
+#include "log.h"
 
 
 float vectors[] = { 2, 2, 2, 3, 3, 3, 4, 4, 4 ,
@@ -8,6 +18,22 @@ float vectors[] = { 2, 2, 2, 3, 3, 3, 4, 4, 4 ,
 double labels[] = { 2, 2, 2, 1, 1, 1, 0, 0, 0 };
 
 
+// threads log concurrently: keep their debug output out of the reference
+static int silence_stderr(void) {
+    int saved_stderr = dup(2);
+    int devnull = open("/dev/null", O_WRONLY);
+    fflush(stderr);
+    dup2(devnull, 2);
+    close(devnull);
+    return saved_stderr;
+}
+
+static void restore_stderr(int saved_stderr) {
+    dup2(saved_stderr, 2);
+    close(saved_stderr);
+}
+
+
 void test_predict() {
     test_header();
 
@@ -84,7 +110,802 @@ void test_predict() {
 }
 
 
+void test_partial_predict() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float vector[3] = {2.1, 1, 1};
+    ET_regression_partial rp1, rp2;
+    ET_class_partial cp1, cp2;
+    class_probability_vec *sharded_cpv, *cpv;
+
+    problem_init(&prob, vectors, labels);
+
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    params.min_split_size = 4;
+
+    forest = ET_forest_build(&prob, &params);
+
+    // shards are combined in reverse order on purpose
+    ET_forest_partial_regression(forest, vector, 1, 0, 4, &rp1);
+    ET_forest_partial_regression(forest, vector, 1, 4, 10, &rp2);
+    ET_regression_partial_combine(&rp2, &rp1);
+    fprintf(stderr, "sharded regression: %g - single: %g\n",
+            ET_regression_partial_value(&rp2),
+            ET_forest_predict_regression(forest, vector, 1));
+
+    ET_class_partial_init(&cp1);
+    ET_class_partial_init(&cp2);
+    ET_forest_partial_classification(forest, vector, 1, 0, 7, &cp1);
+    ET_forest_partial_classification(forest, vector, 1, 7, 10, &cp2);
+    ET_class_partial_combine(&cp2, &cp1);
+    fprintf(stderr, "sharded majority: %g - single: %g\n",
+            ET_class_partial_majority(&cp2),
+            ET_forest_predict_class_majority(forest, vector, 1));
+
+    sharded_cpv = ET_class_partial_probability(forest, &cp2, true);
+    cpv = ET_forest_predict_probability(forest, vector, 1, true);
+    for(size_t i = 0; i < kv_size(*cpv); i++) {
+        fprintf(stderr, "class %g -> sharded: %g single: %g\n",
+                kv_A(*cpv, i).label, kv_A(*sharded_cpv, i).probability,
+                kv_A(*cpv, i).probability);
+    }
+
+    kv_destroy(*sharded_cpv);
+    free(sharded_cpv);
+    kv_destroy(*cpv);
+    free(cpv);
+    ET_class_partial_destroy(&cp1);
+    ET_class_partial_destroy(&cp2);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// 8 samples of class 0 and 2 of class 1, classes overlapping on 6 and 7
+float imbalanced_vectors[] = { 0, 1, 2, 3, 4, 5, 6, 7, 6, 7 };
+double imbalanced_labels[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1 };
+
+void test_class_sample_cap() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float vector[1] = {6.5};
+    class_probability_vec *cpv;
+
+    problem_init(&prob, imbalanced_vectors, imbalanced_labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 20;
+
+    for(uint32_t cap = 0; cap <= 2; cap += 2) {
+        params.class_sample_cap = cap;
+        forest = ET_forest_build(&prob, &params);
+
+        fprintf(stderr, "class sample cap: %d\n", cap);
+        for(size_t i = 0; i < kv_size(forest->class_correction); i += 2) {
+            fprintf(stderr, "    class %g correction: %g\n",
+                    kv_A(forest->class_correction, i),
+                    kv_A(forest->class_correction, i + 1));
+        }
+        cpv = ET_forest_predict_probability(forest, vector, 1, false);
+        for(size_t i = 0; i < kv_size(*cpv); i++) {
+            class_probability *cp = &kv_A(*cpv, i);
+            fprintf(stderr, "    class %g -> %g\n", cp->label, cp->probability);
+        }
+
+        kv_destroy(*cpv);
+        free(cpv);
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+}
+
+
+// batch predictions must equal the single vector ones, for both layouts
+void test_batch_predict() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float rows[] = { 3, 4, 4,
+                     2, 1, 1,
+                     2.1, 1, 1,
+                     4, 4, 2,
+                     3, 4, 3 };
+    float columns[15];
+    double y[5], probabilities[5 * 3];
+    double_vec *classes;
+
+    for(uint32_t r = 0; r < 5; r++) {
+        for(uint32_t fid = 0; fid < 3; fid++) {
+            columns[fid * 5 + r] = rows[r * 3 + fid];
+        }
+    }
+    ET_matrix matrices[2] = {{rows, 5, 3, false}, {columns, 5, 3, true}};
+
+    problem_init(&prob, vectors, labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 5;
+    forest = ET_forest_build(&prob, &params);
+    classes = ET_forest_classes(forest);
+
+    for(int m = 0; m < 2; m++) {
+        ET_matrix *X = &matrices[m];
+        uint32_t n_equal = 0;
+
+        fprintf(stderr, "column major: %d\n", X->column_major);
+        ET_forest_predict_regression_batch(forest, X, 1, 1, y);
+        for(uint32_t r = 0; r < 5; r++) {
+            n_equal += y[r] ==
+                ET_forest_predict_regression(forest, &rows[3 * r], 1);
+        }
+        ET_forest_predict_class_majority_batch(forest, X, 1, 1, y);
+        for(uint32_t r = 0; r < 5; r++) {
+            n_equal += y[r] ==
+                ET_forest_predict_class_majority(forest, &rows[3 * r], 1);
+        }
+        ET_forest_predict_class_bayes_batch(forest, X, 1, true, 1, y);
+        for(uint32_t r = 0; r < 5; r++) {
+            n_equal += y[r] ==
+                ET_forest_predict_class_bayes(forest, &rows[3 * r], 1, true);
+        }
+        ET_forest_predict_probability_batch(forest, X, 1, true, 1,
+                                            probabilities);
+        for(uint32_t r = 0; r < 5; r++) {
+            class_probability_vec *cpv =
+                ET_forest_predict_probability(forest, &rows[3 * r], 1, true);
+            bool equal = true;
+            for(size_t k = 0; k < kv_size(*cpv); k++) {
+                equal &= kv_A(*cpv, k).label == kv_A(*classes, k) &&
+                         kv_A(*cpv, k).probability ==
+                                probabilities[r * kv_size(*classes) + k];
+            }
+            n_equal += equal;
+            kv_destroy(*cpv);
+            free(cpv);
+        }
+        fprintf(stderr, "batch predictions equal to single ones: %d/20\n",
+                n_equal);
+    }
+
+    kv_destroy(*classes);
+    free(classes);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// threads split rows (600 rows are 3 blocks) or, with more threads than
+// blocks, trees: outputs must not change
+void test_parallel_batch_predict() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    uint32_t n_rows = 600, threads[] = {2, 8};
+    float *rows = malloc(n_rows * 3 * sizeof(float));
+    double *reference = malloc(n_rows * 3 * sizeof(double));
+    double *out = malloc(n_rows * 3 * sizeof(double));
+    ET_matrix X = {rows, n_rows, 3, false};
+    int saved_stderr;
+
+    for(uint32_t i = 0; i < n_rows * 3; i++) {
+        rows[i] = (i * 7919 % 1000) / 200.;
+    }
+    problem_init(&prob, vectors, labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 20;
+
+    saved_stderr = silence_stderr();
+    forest = ET_forest_build(&prob, &params);
+    restore_stderr(saved_stderr);
+
+    for(int output = 0; output < 4; output++) {
+        size_t size = n_rows * (output == 3 ? 3 : 1) * sizeof(double);
+        for(int i = -1; i < 2; i++) {
+            uint32_t n_threads = i < 0 ? 1 : threads[i];
+            double *y = i < 0 ? reference : out;
+
+            saved_stderr = silence_stderr();
+            switch(output) {
+                case 0: ET_forest_predict_regression_batch(forest, &X, 1,
+                                                           n_threads, y);
+                        break;
+                case 1: ET_forest_predict_class_majority_batch(forest, &X, 1,
+                                                               n_threads, y);
+                        break;
+                case 2: ET_forest_predict_class_bayes_batch(forest, &X, 1,
+                                                            true, n_threads,
+                                                            y);
+                        break;
+                case 3: ET_forest_predict_probability_batch(forest, &X, 1,
+                                                            true, n_threads,
+                                                            y);
+                        break;
+            }
+            restore_stderr(saved_stderr);
+            if (i >= 0) {
+                fprintf(stderr, "output %d, %d threads: %s\n", output,
+                        n_threads, memcmp(reference, out, size) ?
+                                   "different" : "identical");
+            }
+        }
+    }
+
+    free(rows);
+    free(reference);
+    free(out);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// the prefixes of a forest, scored in one walk, predict as the forests
+// truncated to them, whatever the threads
+void test_prefixes_batch_predict() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    uint32_t n_rows = 600, prefixes[] = {1, 4, 10}, threads[] = {1, 3};
+    float *rows = malloc(n_rows * 3 * sizeof(float));
+    double *y = malloc(n_rows * 3 * sizeof(double));
+    double *reference = malloc(n_rows * sizeof(double));
+    ET_matrix X = {rows, n_rows, 3, false};
+    int saved_stderr;
+
+    for(uint32_t i = 0; i < n_rows * 3; i++) {
+        rows[i] = (i * 7919 % 1000) / 200.;
+    }
+    problem_init(&prob, vectors, labels);
+
+    for(int regression = 0; regression <= 1; regression++) {
+        ET_forest *forest;
+
+        EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+        params.regression = regression;
+        params.number_of_trees = 10;
+        saved_stderr = silence_stderr();
+        forest = ET_forest_build(&prob, &params);
+        restore_stderr(saved_stderr);
+
+        for(uint32_t t = 0; t < 2; t++) {
+            uint32_t n_equal = 0;
+
+            saved_stderr = silence_stderr();
+            ET_forest_predict_prefixes_batch(forest, &X, prefixes, 3, 1,
+                                             threads[t], y);
+            for(uint32_t p = 0; p < 3; p++) {
+                size_t n_trees = kv_size(forest->trees);
+
+                forest->trees.n = prefixes[p];
+                if (regression) {
+                    ET_forest_predict_regression_batch(forest, &X, 1, 1,
+                                                       reference);
+                } else {
+                    ET_forest_predict_class_majority_batch(forest, &X, 1, 1,
+                                                           reference);
+                }
+                forest->trees.n = n_trees;
+                for(uint32_t r = 0; r < n_rows; r++) {
+                    n_equal += y[r * 3 + p] == reference[r];
+                }
+            }
+            restore_stderr(saved_stderr);
+            fprintf(stderr, "%s, %d threads: prefixes equal to truncated "
+                    "forests: %d/%d\n", regression ? "regression" :
+                    "classification", threads[t], n_equal, 3 * n_rows);
+        }
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+
+    free(rows);
+    free(y);
+    free(reference);
+}
+
+
+// the lanes walk, scalar and as dispatched, ends where tree_descend does:
+// full and partial lane groups, fewer rows than lanes, NaN features, in
+// row-major and column-major matrices
+void test_descend_lanes() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    uint32_t n_rows[] = {1, 5, 8, 13, 21};
+    uint32_t curtails[] = {1, 3};
+    float rows[21 * 3], columns[3 * 21];
+    int saved_stderr;
+
+    for(uint32_t r = 0; r < 21; r++) {
+        for(uint32_t fid = 0; fid < 3; fid++) {
+            uint32_t i = 3 * r + fid;
+            rows[i] = r == 4 || i % 7 == 3 ? NAN : (i * 7919 % 1000) / 200.;
+            columns[fid * 21 + r] = rows[i];
+        }
+    }
+
+    problem_init(&prob, vectors, labels);
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    params.min_split_size = 1;
+    saved_stderr = silence_stderr();
+    forest = ET_forest_build(&prob, &params);
+    restore_stderr(saved_stderr);
+
+    for(int avx2 = 0; avx2 <= 1; avx2++) {
+        lanes_descend_function descend = lanes_descend(avx2);
+        uint32_t n_ends = 0, n_equal = 0;
+
+        for(uint32_t c = 0; c < 2; c++)
+        for(uint32_t t = 0; t < kv_size(forest->trees); t++)
+        for(uint32_t n = 0; n < sizeof(n_rows) / sizeof(n_rows[0]); n++)
+        for(int column_major = 0; column_major <= 1; column_major++) {
+            size_t stride = column_major ? 21 : 1;
+            ET_tree tree = kv_A(forest->trees, t);
+
+            for(uint32_t r = 0; r < n_rows[n]; r += LANES) {
+                uint32_t n_lanes = n_rows[n] - r < LANES ? n_rows[n] - r :
+                                                         LANES;
+                float *lanes[LANES];
+                ET_base_node *ends[LANES];
+
+                for(uint32_t l = 0; l < n_lanes; l++) {
+                    lanes[l] = column_major ? &columns[r + l] :
+                                              &rows[3 * (r + l)];
+                }
+                descend(tree, lanes, stride, curtails[c], n_lanes, ends);
+                for(uint32_t l = 0; l < n_lanes; l++) {
+                    n_equal += ends[l] == tree_descend(tree, lanes[l], stride,
+                                                       curtails[c]);
+                    n_ends++;
+                }
+            }
+        }
+        fprintf(stderr, "%s lanes equal to tree_descend: %d/%d\n",
+                avx2 ? "dispatched" : "scalar", n_equal, n_ends);
+    }
+
+    // batch prediction through the dispatched walk, then with the scalar
+    // fallback forced
+    for(int column_major = 0; column_major <= 1; column_major++) {
+        ET_matrix X = {column_major ? columns : rows, 21, 3, column_major};
+        double dispatched[21], scalar[21];
+        bool forced;
+
+        saved_stderr = silence_stderr();
+        ET_forest_predict_regression_batch(forest, &X, 1, 1, dispatched);
+        setenv("ET_NO_AVX2", "1", 1);
+        forced = lanes_descend(true) == lanes_descend(false);
+        ET_forest_predict_regression_batch(forest, &X, 1, 1, scalar);
+        unsetenv("ET_NO_AVX2");
+        restore_stderr(saved_stderr);
+        fprintf(stderr, "column major: %d, scalar walk forced: %d, "
+                "predictions %s\n", column_major, forced,
+                memcmp(dispatched, scalar, sizeof(scalar)) ? "different" :
+                                                             "identical");
+    }
+
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// the bitvector scorer must agree with the tree walk, NaN included
+void test_quickscorer() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    ET_quickscorer *qs;
+    uint32_t n_rows = 200;
+    float *rows = malloc(n_rows * 3 * sizeof(float));
+    double *y = malloc(n_rows * sizeof(double));
+    ET_matrix X = {rows, n_rows, 3, false};
+    int saved_stderr;
+
+    for(uint32_t i = 0; i < n_rows * 3; i++) {
+        rows[i] = (i * 7919 % 1000) / 200.;
+    }
+    rows[0] = NAN;
+    rows[4] = NAN;
+    problem_init(&prob, vectors, labels);
+
+    for(int regression = 1; regression >= 0; regression--) {
+        uint32_t n_equal = 0;
+
+        if (regression) {
+            EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+        } else {
+            EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+        }
+        params.number_of_trees = 20;
+        saved_stderr = silence_stderr();
+        forest = ET_forest_build(&prob, &params);
+        restore_stderr(saved_stderr);
+
+        qs = ET_quickscorer_new(forest);
+        saved_stderr = silence_stderr();
+        ET_quickscorer_predict_batch(qs, &X, y);
+        for(uint32_t r = 0; r < n_rows; r++) {
+            double expected = ET_forest_predict(forest, &rows[3 * r]);
+            n_equal += y[r] == expected &&
+                       ET_quickscorer_predict(qs, &rows[3 * r]) == expected;
+        }
+        restore_stderr(saved_stderr);
+        fprintf(stderr, "regression %d, quickscorer equal to forest: "
+                "%d/%d\n", regression, n_equal, n_rows);
+
+        ET_quickscorer_destroy(qs);
+        free(qs);
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+
+    free(rows);
+    free(y);
+}
+
+
+// the generated source is compiled, loaded, and run on rows with NaN
+// features: its predictions must be those of ET_forest_predict
+void test_codegen() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest = NULL;
+    void *handle = NULL;
+    char dir[] = "/tmp/et_codegen_XXXXXX", source[64], library[64];
+    char command[256];
+    const char *cc = getenv("CC") ? getenv("CC") : "gcc";
+    float rows[60 * 3];
+    int saved_stderr;
+
+    check(mkdtemp(dir), "could not create a temporary directory");
+    snprintf(source, sizeof(source), "%s/forest.c", dir);
+    snprintf(library, sizeof(library), "%s/forest.so", dir);
+    snprintf(command, sizeof(command), "%s -std=c99 -O2 -shared -fPIC "
+             "-o %s %s", cc, library, source);
+    for(uint32_t i = 0; i < 60 * 3; i++) {
+        rows[i] = i % 7 == 3 ? NAN : (i * 7919 % 1000) / 200.;
+    }
+
+    problem_init(&prob, vectors, labels);
+    for(int regression = 1; regression >= 0; regression--) {
+        const char *name = regression ? "predict_regr" : "predict_classif";
+        double (*predict)(void *, float *);
+        FILE *f;
+        uint32_t n_equal = 0;
+
+        if (regression) {
+            EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+        } else {
+            EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+        }
+        params.number_of_trees = 20;
+        params.min_split_size = 2;
+        saved_stderr = silence_stderr();
+        forest = ET_forest_build(&prob, &params);
+        restore_stderr(saved_stderr);
+
+        f = fopen(source, "w");
+        check(f, "could not open %s", source);
+        fprintf(stderr, "codegen: %d\n", ET_forest_codegen(forest, name, f));
+        fclose(f);
+        fprintf(stderr, "compiled: %d\n", system(command) == 0);
+        handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+        check(handle, "could not load %s: %s", library, dlerror());
+        *(void **) &predict = dlsym(handle, name);
+        check(predict, "%s not found", name);
+
+        saved_stderr = silence_stderr();
+        for(uint32_t r = 0; r < 60; r++) {
+            double expected = ET_forest_predict(forest, &rows[3 * r]);
+            double y = predict(NULL, &rows[3 * r]);
+            n_equal += ! memcmp(&expected, &y, sizeof(double));
+        }
+        restore_stderr(saved_stderr);
+        fprintf(stderr, "%s equal to ET_forest_predict: %d/60\n", name,
+                n_equal);
+
+        dlclose(handle);
+        handle = NULL;
+        ET_forest_destroy(forest);
+        free(forest);
+        forest = NULL;
+    }
+
+    exit:
+    if (handle) dlclose(handle);
+    if (forest) {
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+    unlink(source);
+    unlink(library);
+    rmdir(dir);
+}
+
+
+// the context variants give the same results, and their buffers stop
+// moving once they fit the forest
+void test_predict_ctx() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *classif, *regr;
+    ET_predict_ctx ctx;
+    float queries[] = {3, 4, 4,  2, 1, 1,  4, 2, 3,  1, 3, 2};
+    void *buffers[6];
+    uint32_t n_equal = 0, n_moved = 0;
+    bool frequency_ready;
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+    saved_stderr = silence_stderr();
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    classif = ET_forest_build(&prob, &params);
+    // contexts share the forest: nothing may be computed lazily in it
+    frequency_ready = classif->class_frequency != NULL;
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    regr = ET_forest_build(&prob, &params);
+    ET_predict_ctx_init(&ctx);
+
+    for(int round = 0; round < 2; round++) {
+        for(int q = 0; q < 4; q++) {
+            float *vector = &queries[3 * q];
+            uint32_t curtail = 1 + q;
+            class_probability_vec *cpv, *ctx_cpv;
+            double *nwa, *ctx_nwa;
+            bool equal;
+
+            n_equal +=
+                ET_forest_predict(classif, vector) ==
+                    ET_forest_predict_ctx(classif, vector, &ctx) &&
+                ET_forest_predict_class_majority(classif, vector, curtail) ==
+                    ET_forest_predict_class_majority_ctx(classif, vector,
+                                                         curtail, &ctx) &&
+                ET_forest_predict_class_bayes(classif, vector, curtail,
+                                              true) ==
+                    ET_forest_predict_class_bayes_ctx(classif, vector,
+                                                      curtail, true, &ctx) &&
+                ET_forest_predict_quantile(regr, vector, 0.5, curtail) ==
+                    ET_forest_predict_quantile_ctx(regr, vector, 0.5,
+                                                   curtail, &ctx);
+
+            cpv = ET_forest_predict_probability(classif, vector, curtail,
+                                                false);
+            ctx_cpv = ET_forest_predict_probability_ctx(classif, vector,
+                                                        curtail, false, &ctx);
+            equal = kv_size(*cpv) == kv_size(*ctx_cpv);
+            for(size_t k = 0; equal && k < kv_size(*cpv); k++) {
+                equal = kv_A(*cpv, k).label == kv_A(*ctx_cpv, k).label &&
+                        kv_A(*cpv, k).probability ==
+                                            kv_A(*ctx_cpv, k).probability;
+            }
+            n_equal += equal;
+            kv_destroy(*cpv);
+            free(cpv);
+
+            nwa = ET_forest_neighbors(regr, vector, curtail);
+            ctx_nwa = ET_forest_neighbors_ctx(regr, vector, curtail, &ctx);
+            n_equal += ! memcmp(nwa, ctx_nwa, prob.n_samples * sizeof(double));
+            free(nwa);
+        }
+
+        {
+            void *now[6] = {ctx.partial.classes.a, ctx.votes.a,
+                            ctx.probabilities.a, ctx.neighbors.a,
+                            ctx.neighbor_weights.a, ctx.quantile_values.a};
+            for(int b = 0; b < 6; b++) {
+                if (round) n_moved += now[b] != buffers[b];
+                buffers[b] = now[b];
+            }
+        }
+    }
+    restore_stderr(saved_stderr);
+    fprintf(stderr, "context predictions equal: %d/24\n", n_equal);
+    fprintf(stderr, "buffers moved after the first round: %d\n", n_moved);
+    fprintf(stderr, "class frequency computed at build: %d\n",
+            frequency_ready);
+
+    ET_predict_ctx_destroy(&ctx);
+    ET_forest_destroy(classif);
+    free(classif);
+    ET_forest_destroy(regr);
+    free(regr);
+}
+
+
+void test_neighbors_sparse() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    ET_neighbors_csr csr;
+    float queries[] = {3, 4, 4,  2, 1, 1,  4, 2, 3,  1, 3, 2};
+    ET_matrix X = {queries, 4, 3, false};
+    uint32_t n_equal = 0;
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+    saved_stderr = silence_stderr();
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    forest = ET_forest_build(&prob, &params);
+    ET_forest_neighbors_batch(forest, &X, 2, 0, 2, &csr);
+    restore_stderr(saved_stderr);
+
+    for(uint32_t q = 0; q < 4; q++) {
+        float *vector = &queries[3 * q];
+        double *nwa = ET_forest_neighbors(forest, vector, 2);
+        neighbor_vec *neighbors = ET_forest_neighbors_sparse(forest, vector,
+                                                             2, 0);
+        neighbor_vec *top = ET_forest_neighbors_sparse(forest, vector, 2, 1);
+        uint32_t n_nonzero = 0;
+        bool equal = true;
+
+        fprintf(stderr, "query %d:", q);
+        for(size_t j = 0; j < kv_size(*neighbors); j++) {
+            ET_neighbor *n = &kv_A(*neighbors, j);
+            fprintf(stderr, " %d:%g", n->sample_idx, n->weight);
+            equal = equal && n->weight == nwa[n->sample_idx] &&
+                    (j == 0 || n->sample_idx > (n - 1)->sample_idx);
+        }
+        fprintf(stderr, ", top 1: %d:%g\n", kv_A(*top, 0).sample_idx,
+                kv_A(*top, 0).weight);
+        for(uint32_t i = 0; i < prob.n_samples; i++) n_nonzero += nwa[i] != 0;
+        n_equal += equal && n_nonzero == kv_size(*neighbors);
+
+        equal = csr.row_offsets[q + 1] - csr.row_offsets[q] ==
+                kv_size(*neighbors);
+        for(size_t j = 0; equal && j < kv_size(*neighbors); j++) {
+            size_t k = csr.row_offsets[q] + j;
+            equal = kv_A(csr.sample_idxs, k) ==
+                                        kv_A(*neighbors, j).sample_idx &&
+                    kv_A(csr.weights, k) == kv_A(*neighbors, j).weight;
+        }
+        n_equal += equal;
+
+        free(nwa);
+        kv_destroy(*neighbors);
+        free(neighbors);
+        kv_destroy(*top);
+        free(top);
+    }
+    fprintf(stderr, "sparse and batch neighbors equal: %d/8\n", n_equal);
+
+    ET_neighbors_csr_destroy(&csr);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+void test_quantiles() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float queries[] = {3, 4, 4,  2, 1, 1,  4, 2, 3,  1, 3, 2};
+    ET_matrix X = {queries, 4, 3, false};
+    double quantiles[] = {0, 0.05, 0.5, 0.95, 1};
+    double y[5], batch_y[4 * 5];
+    uint32_t n_equal = 0;
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+    saved_stderr = silence_stderr();
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    forest = ET_forest_build(&prob, &params);
+    ET_forest_predict_quantiles_batch(forest, &X, quantiles, 5, 3, 2,
+                                      batch_y);
+    restore_stderr(saved_stderr);
+
+    for(uint32_t q = 0; q < 4; q++) {
+        float *vector = &queries[3 * q];
+
+        ET_forest_predict_quantiles(forest, vector, quantiles, 5, 3, y);
+        fprintf(stderr, "query %d:", q);
+        for(int k = 0; k < 5; k++) {
+            fprintf(stderr, " q%g=%g", quantiles[k], y[k]);
+            n_equal += y[k] == ET_forest_predict_quantile(forest, vector,
+                                                          quantiles[k], 3) &&
+                       y[k] == batch_y[q * 5 + k];
+        }
+        fprintf(stderr, "\n");
+    }
+    fprintf(stderr, "single and batch quantiles equal: %d/20\n", n_equal);
+
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+void test_split_summaries() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *classif, *regr;
+    float queries[] = {3, 4, 4,  2, 1, 1,  4, 2, 3,  1, 3, 2};
+    double before[4][4][3];
+    uint32_t n_equal = 0;
+    int saved_stderr;
+
+    problem_init(&prob, vectors, labels);
+    saved_stderr = silence_stderr();
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    classif = ET_forest_build(&prob, &params);
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 20;
+    regr = ET_forest_build(&prob, &params);
+
+    for(int pass = 0; pass < 2; pass++) {
+        if (pass) {
+            ET_forest_summarize_splits(classif);
+            ET_forest_summarize_splits(regr);
+        }
+        for(int q = 0; q < 4; q++) {
+            for(uint32_t curtail = 1; curtail <= 4; curtail++) {
+                float *vector = &queries[3 * q];
+                double y[3] = {
+                    ET_forest_predict_regression(regr, vector, 2 * curtail),
+                    ET_forest_predict_class_majority(classif, vector,
+                                                     2 * curtail),
+                    ET_forest_predict_class_bayes(classif, vector,
+                                                  2 * curtail, true)};
+                for(int k = 0; k < 3; k++) {
+                    if (pass) {
+                        n_equal += y[k] == before[q][curtail - 1][k];
+                    } else {
+                        before[q][curtail - 1][k] = y[k];
+                    }
+                }
+            }
+        }
+    }
+    restore_stderr(saved_stderr);
+    fprintf(stderr, "root split summarized: %d\n",
+            kv_A(regr->trees, 0)->type == ET_SPLIT_NODE &&
+            ((ET_split_node *) kv_A(regr->trees, 0))->summarized);
+    fprintf(stderr, "curtailed predictions equal: %d/48\n", n_equal);
+
+    ET_forest_destroy(classif);
+    free(classif);
+    ET_forest_destroy(regr);
+    free(regr);
+}
+
 int main() {
     test_predict();
+    test_partial_predict();
+    test_class_sample_cap();
+    test_batch_predict();
+    test_parallel_batch_predict();
+    test_prefixes_batch_predict();
+    test_descend_lanes();
+    test_quickscorer();
+    test_codegen();
+    test_predict_ctx();
+    test_neighbors_sparse();
+    test_quantiles();
+    test_split_summaries();
     return 0;
 }
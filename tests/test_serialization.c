@@ -2,6 +2,7 @@
 #include "train.h"
 #include "test.h"
 #include "log.h"
+#include "counter.h"
 #include "serialization.c"
 
 
@@ -69,12 +70,13 @@ void test_forest_serialization() {
 
     mobile_buffer = buffer.a;
     forest2 = ET_forest_load(&mobile_buffer);
-    forest2->params = forest->params; // FIXME
 
     fprintf(stderr, "orig   forest pred: %g\n",
         ET_forest_predict(forest, vector));
     fprintf(stderr, "cloned forest pred: %g\n",
         ET_forest_predict(forest2, vector));
+    fprintf(stderr, "cloned forest labels counted at load: %zu/%zu\n",
+        kv_size(*forest2->class_frequency), kv_size(*forest->class_frequency));
 
     kv_destroy(buffer);
     ET_forest_destroy(forest);
@@ -84,8 +86,265 @@ void test_forest_serialization() {
 }
 
 
+// the layout of the dumps written before the forest header: the params
+// struct as is, then samples and trees
+static void forest_legacy_dump(ET_forest *forest, uchar_vec *buffer) {
+    struct {
+        uint32_t number_of_features_tested;
+        uint32_t number_of_trees;
+        bool regression;
+        uint32_t min_split_size;
+        bool select_features_with_replacement;
+    } params;
+
+    memset(&params, 0, sizeof(params));
+    params.number_of_features_tested =
+                                forest->params.number_of_features_tested;
+    params.number_of_trees = forest->params.number_of_trees;
+    params.regression = forest->params.regression;
+    params.min_split_size = forest->params.min_split_size;
+    params.select_features_with_replacement =
+                        forest->params.select_features_with_replacement;
+
+    for(size_t i = 0; i < sizeof(params); i++) {
+        dump_char(((char *) &params)[i], buffer);
+    }
+    dump_double(forest->n_features, buffer);
+    dump_double(forest->n_samples, buffer);
+    for(uint32_t i = 0; i < forest->n_samples; i++) {
+        dump_double(forest->labels[i], buffer);
+    }
+    dump_uint32(kv_size(forest->trees), buffer);
+    for(size_t i = 0; i < kv_size(forest->trees); i++) {
+        ET_tree_dump(kv_A(forest->trees, i), buffer);
+    }
+}
+
+// dumps without header load as the legacy layout, dumps of a newer version
+// are not loaded
+void test_forest_dump_version() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest, *loaded;
+    uchar_vec buffer, legacy;
+    unsigned char *mobile_buffer;
+    float vector[] = {3, 1, 1, 6, 6, 2};
+
+    kv_init(buffer);
+    kv_init(legacy);
+    problem_init(&prob, big_vectors, big_labels);
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 2;
+    params.mad_diversity = true;
+    params.min_split_size = 3;
+
+    forest = ET_forest_build(&prob, &params);
+    ET_forest_dump(forest, &buffer, true);
+
+    mobile_buffer = buffer.a;
+    loaded = ET_forest_load(&mobile_buffer);
+    fprintf(stderr, "current version loaded: %d, buffer used: %d\n",
+            loaded != NULL,
+            (size_t) (mobile_buffer - buffer.a) == kv_size(buffer));
+    fprintf(stderr, "params: %d %d %d %d %d %d %d %d\n",
+            loaded->params.number_of_features_tested,
+            loaded->params.number_of_trees, loaded->params.regression,
+            loaded->params.single_precision, loaded->params.mad_diversity,
+            loaded->params.min_split_size,
+            loaded->params.select_features_with_replacement,
+            loaded->params.class_sample_cap);
+    ET_forest_destroy(loaded);
+    free(loaded);
+
+    // a dump without header, written as before the format versions
+    forest_legacy_dump(forest, &legacy);
+    mobile_buffer = legacy.a;
+    loaded = ET_forest_load(&mobile_buffer);
+    fprintf(stderr, "dump without header loaded: %d, buffer used: %d\n",
+            loaded != NULL,
+            (size_t) (mobile_buffer - legacy.a) == kv_size(legacy));
+    fprintf(stderr, "legacy params: %d %d %d %d %d\n",
+            loaded->params.number_of_features_tested,
+            loaded->params.number_of_trees, loaded->params.regression,
+            loaded->params.min_split_size,
+            loaded->params.select_features_with_replacement);
+    fprintf(stderr, "legacy pred: %g, orig pred: %g\n",
+            ET_forest_predict(loaded, vector),
+            ET_forest_predict(forest, vector));
+    ET_forest_destroy(loaded);
+    free(loaded);
+
+    kv_A(buffer, 4) = FOREST_VERSION + 1;
+    mobile_buffer = buffer.a;
+    loaded = ET_forest_load(&mobile_buffer);
+    fprintf(stderr, "next version loaded: %d\n", loaded != NULL);
+
+    kv_destroy(buffer);
+    kv_destroy(legacy);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+typedef struct {
+    uint32_t n_leaves;
+    uint32_t n_summarized;
+    uint32_t n_mixed;
+    uint32_t n_counters;
+    double_vec sums;
+    double_vec classes;
+} leaf_summaries;
+
+static void collect_summary(ET_base_node *node, leaf_summaries *ls) {
+    ET_leaf_node *ln = CAST_LEAF(node);
+    if (! IS_LEAF(node)) return;
+    ls->n_leaves++;
+    ls->n_summarized += ln->summarized;
+    ls->n_mixed += ! ln->constant;
+    ls->n_counters += ln->classes != NULL;
+    kv_push(double, ls->sums, ln->label_sum);
+    if (ln->constant) kv_push(double, ls->classes, ln->label);
+    for(size_t k = 0; ln->classes && k < kv_size(*ln->classes); k++) {
+        kv_push(double, ls->classes, kv_A(*ln->classes, k).key);
+        kv_push(double, ls->classes, kv_A(*ln->classes, k).count);
+    }
+}
+
+// leaves are summarized once built, and again once loaded
+void test_leaf_summaries() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest[2];
+    leaf_summaries ls[2];
+    uchar_vec buffer;
+    unsigned char *mobile_buffer;
+
+    kv_init(buffer);
+    problem_init(&prob, big_vectors, big_labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    params.min_split_size = 3;
+
+    forest[0] = ET_forest_build(&prob, &params);
+    ET_forest_dump(forest[0], &buffer, true);
+    mobile_buffer = buffer.a;
+    forest[1] = ET_forest_load(&mobile_buffer);
+
+    for(int f = 0; f < 2; f++) {
+        ls[f] = (leaf_summaries) {0, 0, 0, 0, {0, 0, NULL}, {0, 0, NULL}};
+        for(size_t t = 0; t < kv_size(forest[f]->trees); t++) {
+            tree_navigate(kv_A(forest[f]->trees, t),
+                          (node_processor) collect_summary, &ls[f]);
+        }
+        fprintf(stderr, "forest %d: %d/%d leaves summarized, %d class "
+                "counters for %d mixed leaves\n", f, ls[f].n_summarized,
+                ls[f].n_leaves, ls[f].n_counters, ls[f].n_mixed);
+    }
+    fprintf(stderr, "loaded summaries equal: %d\n",
+            kv_size(ls[0].sums) == kv_size(ls[1].sums) &&
+            kv_size(ls[0].classes) == kv_size(ls[1].classes) &&
+            ! memcmp(ls[0].sums.a, ls[1].sums.a,
+                     kv_size(ls[0].sums) * sizeof(double)) &&
+            ! memcmp(ls[0].classes.a, ls[1].classes.a,
+                     kv_size(ls[0].classes) * sizeof(double)));
+
+    for(int f = 0; f < 2; f++) {
+        kv_destroy(ls[f].sums);
+        kv_destroy(ls[f].classes);
+        ET_forest_destroy(forest[f]);
+        free(forest[f]);
+    }
+    kv_destroy(buffer);
+}
+
+
+typedef struct {
+    uint32_t n_splits;
+    uint32_t n_summarized;
+    double_vec aggregates;
+} split_summaries;
+
+static void collect_split_summary(ET_base_node *node, split_summaries *ss) {
+    ET_split_node *sn = CAST_SPLIT(node);
+    if (! IS_SPLIT(node)) return;
+    ss->n_splits++;
+    ss->n_summarized += sn->summarized && sn->classes;
+    kv_push(double, ss->aggregates, sn->label_sum);
+    for(size_t k = 0; sn->classes && k < kv_size(*sn->classes); k++) {
+        kv_push(double, ss->aggregates, kv_A(*sn->classes, k).key);
+        kv_push(double, ss->aggregates, kv_A(*sn->classes, k).count);
+    }
+}
+
+// split summaries are not dumped, but computed again once loaded, and on
+// the trees merged into a summarized forest
+void test_split_summaries_kept() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest[2], *other;
+    split_summaries ss[2];
+    uchar_vec buffer;
+    unsigned char *mobile_buffer;
+
+    kv_init(buffer);
+    problem_init(&prob, big_vectors, big_labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    params.min_split_size = 1;
+
+    forest[0] = ET_forest_build(&prob, &params);
+    ET_forest_summarize_splits(forest[0]);
+    ET_forest_dump(forest[0], &buffer, true);
+    mobile_buffer = buffer.a;
+    forest[1] = ET_forest_load(&mobile_buffer);
+
+    for(int f = 0; f < 2; f++) {
+        ss[f] = (split_summaries) {0, 0, {0, 0, NULL}};
+        for(size_t t = 0; t < kv_size(forest[f]->trees); t++) {
+            tree_navigate(kv_A(forest[f]->trees, t),
+                          (node_processor) collect_split_summary, &ss[f]);
+        }
+        fprintf(stderr, "forest %d: %d/%d splits summarized\n", f,
+                ss[f].n_summarized, ss[f].n_splits);
+    }
+    fprintf(stderr, "loaded split summaries equal: %d\n",
+            kv_size(ss[0].aggregates) == kv_size(ss[1].aggregates) &&
+            ! memcmp(ss[0].aggregates.a, ss[1].aggregates.a,
+                     kv_size(ss[0].aggregates) * sizeof(double)));
+
+    other = ET_forest_build(&prob, &params);
+    ET_forest_merge(forest[1], other);
+    kv_destroy(ss[1].aggregates);
+    ss[1] = (split_summaries) {0, 0, {0, 0, NULL}};
+    for(size_t t = 0; t < kv_size(forest[1]->trees); t++) {
+        tree_navigate(kv_A(forest[1]->trees, t),
+                      (node_processor) collect_split_summary, &ss[1]);
+    }
+    fprintf(stderr, "merged forest: %d/%d splits summarized\n",
+            ss[1].n_summarized, ss[1].n_splits);
+
+    for(int f = 0; f < 2; f++) {
+        kv_destroy(ss[f].aggregates);
+        ET_forest_destroy(forest[f]);
+        free(forest[f]);
+    }
+    ET_forest_destroy(other);
+    free(other);
+    kv_destroy(buffer);
+}
+
+
 int main() {
     test_forest_serialization();
     test_double_float();
+    test_forest_dump_version();
+    test_leaf_summaries();
+    test_split_summaries_kept();
     return 0;
 }
@@ -1,7 +1,14 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
 #include "extratrees.h"
 #include "train.h"
 #include "test.h"
 #include "log.h"
+#include "util.h"
 
 
 float big_vectors[] = { 1., 3., 2., 3., 0.,
@@ -111,10 +118,438 @@ void test_forest() {
 }
 
 
+void test_forest_stats() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    ET_train_stats stats;
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 3;
+
+    ET_train_stats_init(&stats);
+    forest = ET_forest_build_stats(&prob, &params, &stats);
+
+    fprintf(stderr, "trees timed: %zu\n", kv_size(stats.tree_time));
+    fprintf(stderr, "nodes: %llu leaves: %llu candidate splits: %llu\n",
+            (unsigned long long) stats.n_nodes,
+            (unsigned long long) stats.n_leaves,
+            (unsigned long long) stats.n_candidate_splits);
+    fprintf(stderr, "samples scanned: %llu constant features: %llu\n",
+            (unsigned long long) stats.n_samples_scanned,
+            (unsigned long long) stats.n_constant_features);
+    fprintf(stderr, "bytes allocated > 0: %d\n", stats.bytes_allocated > 0);
+
+    ET_train_stats_destroy(&stats);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+void test_forest_merge() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest, *other;
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 2;
+
+    forest = ET_forest_build(&prob, &params);
+    other  = ET_forest_build(&prob, &params);
+
+    fprintf(stderr, "merge: %d\n", ET_forest_merge(forest, other));
+    fprintf(stderr, "trees: %zu (params: %d) - other trees: %zu\n",
+            kv_size(forest->trees), forest->params.number_of_trees,
+            kv_size(other->trees));
+
+    ET_forest_destroy(other);
+    free(other);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+void test_forest_multiprocess() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float vector[] = {3, 1, 1, 6, 6, 2};
+    int saved_stderr, devnull;
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 10;
+
+    // workers log concurrently: keep their debug output out of the reference
+    fflush(stderr);
+    saved_stderr = dup(2);
+    devnull = open("/dev/null", O_WRONLY);
+    dup2(devnull, 2);
+    forest = ET_forest_build_multiprocess(&prob, &params, 3);
+    dup2(saved_stderr, 2);
+    close(devnull);
+    close(saved_stderr);
+
+    fprintf(stderr, "trees: %zu (params: %d)\n", kv_size(forest->trees),
+                                                 forest->params.number_of_trees);
+    fprintf(stderr, "prediction: %g\n", ET_forest_predict(forest, vector));
+
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+void test_forest_view() {
+    test_header();
+
+    ET_problem prob;
+    ET_problem_view view;
+    ET_params params;
+    ET_forest *forest;
+    double *importance;
+    uint32_t sample_idxs[] = {0, 1, 3, 4};
+    uint32_t feature_idxs[] = {1, 3, 4};
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    view = (ET_problem_view) {&prob, sample_idxs, 4, feature_idxs, 3};
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(view, params);
+    params.number_of_trees = 3;
+
+    forest = ET_forest_build_view(&view, &params, NULL);
+    importance = ET_forest_feature_importance(forest, 1);
+    for(uint32_t i = 0; i < forest->n_features; i++) {
+        fprintf(stderr, "feature #%d -> importance: %g\n", i, importance[i]);
+    }
+
+    free(importance);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// classes and priors come from the samples of the view only
+void test_forest_view_classes() {
+    test_header();
+
+    ET_problem prob;
+    ET_problem_view view;
+    ET_params params;
+    ET_forest *forest;
+    double_vec *classes;
+    class_probability_vec *cpv;
+    uint32_t sample_idxs[] = {0, 1, 2, 4};
+    float vector[] = {1., 4., 1., 4., 8., 2.};
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    ET_problem_view_init(&view, &prob);
+    view.sample_idxs = sample_idxs;
+    view.n_samples = 4;
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(view, params);
+    params.number_of_trees = 3;
+
+    forest = ET_forest_build_view(&view, &params, NULL);
+    classes = ET_forest_classes(forest);
+    for(size_t i = 0; i < kv_size(*classes); i++) {
+        fprintf(stderr, "class: %g\n", kv_A(*classes, i));
+    }
+    cpv = ET_forest_predict_probability(forest, vector, 1, true);
+    for(size_t i = 0; i < kv_size(*cpv); i++) {
+        fprintf(stderr, "class: %g probability: %g\n", kv_A(*cpv, i).label,
+                                                      kv_A(*cpv, i).probability);
+    }
+
+    kv_destroy(*classes);
+    free(classes);
+    kv_destroy(*cpv);
+    free(cpv);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+void test_forest_feature_types() {
+    test_header();
+
+    ET_problem prob, typed_prob;
+    ET_params params;
+    ET_forest *forest, *typed_forest;
+    uchar_vec dump, typed_dump;
+    size_t n_values = sizeof(big_vectors) / sizeof(*big_vectors);
+    double double_vectors[sizeof(big_vectors) / sizeof(*big_vectors)];
+    uint8_t uint8_vectors[sizeof(big_vectors) / sizeof(*big_vectors)];
+
+    for(size_t i = 0; i < n_values; i++) {
+        double_vectors[i] = big_vectors[i];
+        uint8_vectors[i] = big_vectors[i];
+    }
+
+    problem_init(&prob, big_vectors, big_labels);
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 3;
+    forest = ET_forest_build(&prob, &params);
+    kv_init(dump);
+    ET_forest_dump(forest, &dump, true);
+
+    for(int type = ET_FLOAT64; type <= ET_UINT8; type++) {
+        typed_prob = prob;
+        typed_prob.feature_type = type;
+        typed_prob.vectors = type == ET_FLOAT64 ? (void *) double_vectors :
+                                                  (void *) uint8_vectors;
+        typed_forest = ET_forest_build(&typed_prob, &params);
+        kv_init(typed_dump);
+        ET_forest_dump(typed_forest, &typed_dump, true);
+
+        fprintf(stderr, "%s forest equal to float32 one: %d\n",
+                type == ET_FLOAT64 ? "float64" : "uint8",
+                kv_size(dump) == kv_size(typed_dump) &&
+                ! memcmp(dump.a, typed_dump.a, kv_size(dump)));
+
+        kv_destroy(typed_dump);
+        ET_forest_destroy(typed_forest);
+        free(typed_forest);
+    }
+
+    kv_destroy(dump);
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// true if the leaf reached by the sample vector is the one holding it
+static bool routed_to_own_leaf(ET_tree tree, ET_problem *prob,
+                               uint32_t sample_idx) {
+    ET_base_node *node = tree;
+    ET_leaf_node *leaf;
+
+    while (IS_SPLIT(node)) {
+        ET_split_node *sn = CAST_SPLIT(node);
+        float val = ((float *) prob->vectors)[sn->feature_id * prob->n_samples +
+                                              sample_idx];
+        node = val <= sn->threshold ? sn->lower_node : sn->higher_node;
+    }
+    leaf = CAST_LEAF(node);
+    for(size_t i = 0; i < kv_size(leaf->indexes); i++) {
+        if (kv_A(leaf->indexes, i) == sample_idx) return true;
+    }
+    return false;
+}
+
+
+void test_forest_single_precision() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float vector[] = {2., 2., 1., 5., 3., 2.};
+
+    problem_init(&prob, big_vectors, big_labels);
+
+    for(int regression = 0; regression <= 1; regression++) {
+        uint32_t n_routed = 0;
+
+        if (regression) {
+            EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+        } else {
+            EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+        }
+        params.number_of_trees = 3;
+        params.single_precision = true;
+        forest = ET_forest_build(&prob, &params);
+
+        for(size_t t = 0; t < kv_size(forest->trees); t++) {
+            for(uint32_t s = 0; s < prob.n_samples; s++) {
+                n_routed += routed_to_own_leaf(kv_A(forest->trees, t),
+                                               &prob, s);
+            }
+        }
+        fprintf(stderr, "regression: %d samples routed to own leaf: %d/%d "
+                        "prediction: %g\n", regression, n_routed,
+                        3 * prob.n_samples,
+                        regression ?
+                            ET_forest_predict_regression(forest, vector, 1) :
+                            ET_forest_predict_class_majority(forest, vector,
+                                                             1));
+
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+}
+
+
+void test_forest_mad() {
+    test_header();
+
+    ET_problem prob;
+    ET_params params;
+    ET_forest *forest;
+    float vector[] = {2., 2., 1., 5., 3., 2.};
+
+    problem_init(&prob, big_vectors, big_labels);
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 3;
+    params.mad_diversity = true;
+
+    forest = ET_forest_build(&prob, &params);
+    fprintf(stderr, "root diversity: %g prediction: %g\n",
+            kv_A(forest->trees, 0)->diversity,
+            ET_forest_predict_regression(forest, vector, 1));
+
+    ET_forest_destroy(forest);
+    free(forest);
+}
+
+
+// big_vectors with feature #0 repeated as feature #6. Feature #2 is constant
+void test_forest_informative_view() {
+    test_header();
+
+    ET_problem prob;
+    ET_problem_view view;
+    ET_params params;
+    ET_forest *forest;
+    double *importance;
+    float vectors[7 * 5];
+
+    memcpy(vectors, big_vectors, sizeof(big_vectors));
+    memcpy(vectors + 6 * 5, big_vectors, 5 * sizeof(float));
+    problem_init(&prob, vectors, big_labels);
+
+    ET_problem_view_init_informative(&view, &prob, 2);
+    fprintf(stderr, "informative features:");
+    for(uint32_t i = 0; i < view.n_features; i++) {
+        fprintf(stderr, " %d", view.feature_idxs[i]);
+    }
+    fprintf(stderr, "\n");
+
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(view, params);
+    params.number_of_trees = 3;
+
+    forest = ET_forest_build_view(&view, &params, NULL);
+    importance = ET_forest_feature_importance(forest, 1);
+    for(uint32_t i = 0; i < forest->n_features; i++) {
+        fprintf(stderr, "feature #%d -> importance: %g\n", i, importance[i]);
+    }
+
+    free(importance);
+    ET_forest_destroy(forest);
+    free(forest);
+    ET_problem_view_destroy(&view);
+}
+
+
+// each sample of big_vectors twice, the last one three times
+void test_problem_collapse() {
+    test_header();
+
+    ET_problem prob, *collapsed;
+    ET_params params;
+    ET_forest *forest, *collapsed_forest;
+    float vectors[6 * 11];
+    double labels[11];
+    float vector[] = {2., 2., 1., 5., 3., 2.};
+
+    for(uint32_t s = 0; s < 11; s++) {
+        uint32_t big_s = s < 10 ? s / 2 : 4;
+        labels[s] = big_labels[big_s];
+        for(uint32_t fid = 0; fid < 6; fid++) {
+            vectors[fid * 11 + s] = big_vectors[fid * 5 + big_s];
+        }
+    }
+    problem_init(&prob, vectors, labels);
+
+    collapsed = ET_problem_collapse(&prob);
+    ET_problem_print(collapsed, stderr);
+
+    EXTRA_TREE_DEFAULT_REGR_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    forest = ET_forest_build(&prob, &params);
+    collapsed_forest = ET_forest_build(collapsed, &params);
+    fprintf(stderr, "regression: %g collapsed: %g\n",
+            ET_forest_predict_regression(forest, vector, 1),
+            ET_forest_predict_regression(collapsed_forest, vector, 1));
+    ET_forest_destroy(forest);
+    free(forest);
+    ET_forest_destroy(collapsed_forest);
+    free(collapsed_forest);
+
+    EXTRA_TREE_DEFAULT_CLASSIF_PARAMS(prob, params);
+    params.number_of_trees = 10;
+    forest = ET_forest_build(&prob, &params);
+    collapsed_forest = ET_forest_build(collapsed, &params);
+    fprintf(stderr, "class: %g collapsed: %g\n",
+            ET_forest_predict_class_bayes(forest, vector, 1, true),
+            ET_forest_predict_class_bayes(collapsed_forest, vector, 1, true));
+    ET_forest_destroy(forest);
+    free(forest);
+    ET_forest_destroy(collapsed_forest);
+    free(collapsed_forest);
+
+    // classes are capped, and corrected, by weight
+    params.class_sample_cap = 3;
+    forest = ET_forest_build(&prob, &params);
+    collapsed_forest = ET_forest_build(collapsed, &params);
+    for(size_t i = 0; i < kv_size(forest->class_correction); i += 2) {
+        fprintf(stderr, "class %g correction: %g collapsed: %g\n",
+                kv_A(forest->class_correction, i),
+                kv_A(forest->class_correction, i + 1),
+                kv_A(collapsed_forest->class_correction, i + 1));
+    }
+    ET_forest_destroy(forest);
+    free(forest);
+
+    // the drawn weight of other trees is averaged in by merging
+    {
+        ET_problem_view view;
+        uint32_t seed[] = {1, 2, 3, 4};
+        double factor = kv_A(collapsed_forest->class_correction, 1);
+        double other_factor;
+
+        ET_problem_view_init(&view, collapsed);
+        forest = forest_build(&view, &params, seed, NULL);
+        other_factor = kv_A(forest->class_correction, 1);
+        ET_forest_merge(collapsed_forest, forest);
+        fprintf(stderr, "class 1 correction: %g merged with %g: %g\n",
+                factor, other_factor,
+                kv_A(collapsed_forest->class_correction, 1));
+        ET_forest_destroy(forest);
+        free(forest);
+    }
+    ET_forest_destroy(collapsed_forest);
+    free(collapsed_forest);
+
+    ET_problem_destroy(collapsed);
+    free(collapsed);
+}
+
+
 int main() {
     test_leaf();
     test_split_classification();
     test_split_regression();
     test_forest();
+    test_forest_stats();
+    test_forest_merge();
+    test_forest_multiprocess();
+    test_forest_view();
+    test_forest_view_classes();
+    test_forest_informative_view();
+    test_forest_feature_types();
+    test_forest_single_precision();
+    test_forest_mad();
+    test_problem_collapse();
     return 0;
 }